@@ -0,0 +1,327 @@
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+using namespace std;
+
+/**
+ * Allocation tracking for the codec benchmarks. Built with
+ * -DTRACK_ALLOCATIONS, this replaces the global operator new and
+ * delete with versions that count the allocations, frees and bytes
+ * of each phase of the program, as marked by begin_allocation_phase,
+ * so an allocation creeping into a hot path such as decoding shows
+ * up in the report. A free is charged to the phase that made the
+ * allocation, so the frees of a phase against its allocations show
+ * what it leaves live. Over-aligned allocations are tracked too.
+ * Without the flag the phase markers and the report do nothing and
+ * the standard allocator is used.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+
+/**
+ * mark the start of a phase; allocations are counted against it
+ * until the next phase begins
+ * @param name the name of the phase, which must outlive the program
+ */
+void begin_allocation_phase( const char *name );
+
+/**
+ * print the allocations, frees and bytes of each phase, the frees
+ * being of the blocks the phase allocated
+ */
+void print_allocation_report();
+
+/**
+ * Return the number of allocations made so far in the current phase
+ */
+uint64_t get_phase_allocations();
+
+#ifdef TRACK_ALLOCATIONS
+
+/**
+ * The counts for one phase. They are kept in a fixed array and
+ * updated atomically, since the allocator cannot allocate and may be
+ * called from several threads at once.
+ */
+struct AllocationPhase
+{
+  const char *name;
+  uint64_t allocations;
+  uint64_t allocated_bytes;
+  uint64_t frees;
+  uint64_t freed_bytes;
+};
+
+const uint MAX_ALLOCATION_PHASES = 32;
+AllocationPhase allocation_phases[ MAX_ALLOCATION_PHASES ] =
+  { { "startup", 0, 0, 0, 0 } };
+uint num_allocation_phases = 1;
+uint current_allocation_phase = 0;
+
+/**
+ * The record kept in the 16 bytes in front of each block, so a free
+ * counts its bytes against the phase that allocated them
+ */
+struct AllocationHeader
+{
+  size_t size;
+  uint phase;
+};
+
+//16 bytes keeps the block aligned as malloc would
+const size_t ALLOCATION_HEADER = 16;
+static_assert( sizeof( AllocationHeader ) <= ALLOCATION_HEADER,
+               "the allocation header must fit in front of the block" );
+
+void begin_allocation_phase( const char *name )
+{
+  if( num_allocation_phases < MAX_ALLOCATION_PHASES )
+  {
+    AllocationPhase &phase = allocation_phases[ num_allocation_phases ];
+    phase.name = name;
+    __atomic_store_n( &current_allocation_phase, num_allocation_phases,
+                      __ATOMIC_RELEASE );
+    num_allocation_phases++;
+  }
+}
+
+void print_allocation_report()
+{
+  cout << "allocations by phase:" << endl;
+  for( uint i = 0; i < num_allocation_phases; i++ )
+  {
+    const AllocationPhase &phase = allocation_phases[ i ];
+    cout << "  " << phase.name << ": "
+         << __atomic_load_n( &phase.allocations, __ATOMIC_RELAXED )
+         << " allocations of "
+         << __atomic_load_n( &phase.allocated_bytes, __ATOMIC_RELAXED )
+         << " bytes, "
+         << __atomic_load_n( &phase.frees, __ATOMIC_RELAXED )
+         << " frees of "
+         << __atomic_load_n( &phase.freed_bytes, __ATOMIC_RELAXED )
+         << " bytes" << endl;
+  }
+  cout << endl;
+}
+
+uint64_t get_phase_allocations()
+{
+  const AllocationPhase &phase = allocation_phases[
+    __atomic_load_n( &current_allocation_phase, __ATOMIC_ACQUIRE ) ];
+  return __atomic_load_n( &phase.allocations, __ATOMIC_RELAXED );
+}
+
+/**
+ * Return the bytes in front of a block of an alignment, the header
+ * rounded up so the block keeps the alignment
+ * @param alignment the alignment, a power of two
+ */
+size_t get_header_bytes( size_t alignment )
+{
+  return alignment > ALLOCATION_HEADER ? alignment : ALLOCATION_HEADER;
+}
+
+/**
+ * allocate a block and count it against the current phase
+ * @param size the bytes asked for
+ * @param alignment the alignment of the block, a power of two
+ * @return the block, or nullptr if there is no memory
+ */
+void *tracked_allocate( size_t size, size_t alignment = ALLOCATION_HEADER )
+{
+  size_t header_bytes = get_header_bytes( alignment );
+  void *memory = nullptr;
+  if( alignment <= ALLOCATION_HEADER )
+  {
+    memory = malloc( size + header_bytes );
+  }
+  else if( posix_memalign( &memory, alignment, size + header_bytes ) != 0 )
+  {
+    memory = nullptr;
+  }
+  if( memory == nullptr )
+  {
+    return nullptr;
+  }
+
+  //the header sits just in front of the block whatever the alignment
+  char *block = static_cast< char * >( memory ) + header_bytes;
+  AllocationHeader *header = reinterpret_cast< AllocationHeader * >(
+    block - ALLOCATION_HEADER );
+  header->size = size;
+  header->phase =
+    __atomic_load_n( &current_allocation_phase, __ATOMIC_ACQUIRE );
+
+  AllocationPhase &phase = allocation_phases[ header->phase ];
+  __atomic_fetch_add( &phase.allocations, 1, __ATOMIC_RELAXED );
+  __atomic_fetch_add( &phase.allocated_bytes, size, __ATOMIC_RELAXED );
+  return block;
+}
+
+/**
+ * free a block from tracked_allocate, counting it against the phase
+ * that allocated it
+ * @param pointer the block, or nullptr
+ * @param alignment the alignment it was allocated with
+ */
+void tracked_free( void *pointer, size_t alignment = ALLOCATION_HEADER )
+{
+  if( pointer == nullptr )
+  {
+    return;
+  }
+  char *block = static_cast< char * >( pointer );
+  const AllocationHeader *header =
+    reinterpret_cast< const AllocationHeader * >( block - ALLOCATION_HEADER );
+
+  AllocationPhase &phase = allocation_phases[ header->phase ];
+  __atomic_fetch_add( &phase.frees, 1, __ATOMIC_RELAXED );
+  __atomic_fetch_add( &phase.freed_bytes, header->size, __ATOMIC_RELAXED );
+  free( block - get_header_bytes( alignment ) );
+}
+
+void *operator new( size_t size )
+{
+  void *pointer = tracked_allocate( size );
+  if( pointer == nullptr )
+  {
+    throw bad_alloc();
+  }
+  return pointer;
+}
+
+void *operator new[]( size_t size )
+{
+  return operator new( size );
+}
+
+void *operator new( size_t size, const nothrow_t & ) noexcept
+{
+  return tracked_allocate( size );
+}
+
+void *operator new[]( size_t size, const nothrow_t & ) noexcept
+{
+  return tracked_allocate( size );
+}
+
+void operator delete( void *pointer ) noexcept
+{
+  tracked_free( pointer );
+}
+
+void operator delete[]( void *pointer ) noexcept
+{
+  tracked_free( pointer );
+}
+
+void operator delete( void *pointer, size_t ) noexcept
+{
+  tracked_free( pointer );
+}
+
+void operator delete[]( void *pointer, size_t ) noexcept
+{
+  tracked_free( pointer );
+}
+
+void operator delete( void *pointer, const nothrow_t & ) noexcept
+{
+  tracked_free( pointer );
+}
+
+void operator delete[]( void *pointer, const nothrow_t & ) noexcept
+{
+  tracked_free( pointer );
+}
+
+#ifdef __cpp_aligned_new
+
+//the over-aligned forms, used for types aligned past 16 bytes
+void *operator new( size_t size, align_val_t alignment )
+{
+  void *pointer = tracked_allocate( size, size_t( alignment ) );
+  if( pointer == nullptr )
+  {
+    throw bad_alloc();
+  }
+  return pointer;
+}
+
+void *operator new[]( size_t size, align_val_t alignment )
+{
+  return operator new( size, alignment );
+}
+
+void *operator new( size_t size, align_val_t alignment,
+                    const nothrow_t & ) noexcept
+{
+  return tracked_allocate( size, size_t( alignment ) );
+}
+
+void *operator new[]( size_t size, align_val_t alignment,
+                      const nothrow_t & ) noexcept
+{
+  return tracked_allocate( size, size_t( alignment ) );
+}
+
+void operator delete( void *pointer, align_val_t alignment ) noexcept
+{
+  tracked_free( pointer, size_t( alignment ) );
+}
+
+void operator delete[]( void *pointer, align_val_t alignment ) noexcept
+{
+  tracked_free( pointer, size_t( alignment ) );
+}
+
+void operator delete( void *pointer, size_t,
+                      align_val_t alignment ) noexcept
+{
+  tracked_free( pointer, size_t( alignment ) );
+}
+
+void operator delete[]( void *pointer, size_t,
+                        align_val_t alignment ) noexcept
+{
+  tracked_free( pointer, size_t( alignment ) );
+}
+
+void operator delete( void *pointer, align_val_t alignment,
+                      const nothrow_t & ) noexcept
+{
+  tracked_free( pointer, size_t( alignment ) );
+}
+
+void operator delete[]( void *pointer, align_val_t alignment,
+                        const nothrow_t & ) noexcept
+{
+  tracked_free( pointer, size_t( alignment ) );
+}
+
+#endif
+
+#else
+
+void begin_allocation_phase( const char * )
+{
+}
+
+void print_allocation_report()
+{
+}
+
+uint64_t get_phase_allocations()
+{
+  return 0;
+}
+
+#endif
+
+#endif
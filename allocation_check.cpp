@@ -0,0 +1,123 @@
+/* A program to check that encoding and decoding a batch of words
+ * with a cyclic code makes no heap allocations beyond the decoded
+ * batch itself. It must be built with -DTRACK_ALLOCATIONS, and exits
+ * with status 1 if any other allocation is counted while the batch
+ * is coded.
+ * @author Jared Allen
+ * @date October 17, 2026
+ */
+
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include "cyclic_codes.h"
+#include "hadamard_decoder.h"
+#include "alloc_tracker.h"
+#include "check_codes.h"
+
+#ifndef TRACK_ALLOCATIONS
+#error "allocation_check must be built with -DTRACK_ALLOCATIONS"
+#endif
+
+using namespace std;
+
+/**
+ * build the cyclic code of a length and generator polynomial
+ * @param code_length the length of the code
+ * @param generator_polynomial g(x), bit i the coefficient of x^i
+ * @return the code
+ */
+CyclicCode build_code( uint code_length, uint generator_polynomial );
+
+/**
+ * encode and decode every word of a code, or a sample when there
+ * are many, with the allocation count of a phase of its own
+ * @param code_length the length of the code
+ * @param generator_polynomial g(x), bit i the coefficient of x^i
+ * @return the number of allocations made while coding besides the
+ * decoded batch, plus the number of words decoded to a non code word
+ * or whose message did not survive encoding
+ */
+uint64_t check_code( uint code_length, uint generator_polynomial );
+
+CyclicCode build_code( uint code_length, uint generator_polynomial )
+{
+  vector< uint > generator;
+  vector< uint > parity_check;
+  build_matrices( code_length, generator_polynomial, generator,
+                  parity_check );
+  return CyclicCode( generator, parity_check, code_length );
+}
+
+uint64_t check_code( uint code_length, uint generator_polynomial )
+{
+  CyclicCode code = build_code( code_length, generator_polynomial );
+  HadamardDecoder hadamard_decoder = HadamardDecoder( code );
+  uint dimension = code.get_generator().size();
+  uint word_mask = code_length < 32 ? ( 1u << code_length ) - 1 : UINT_MAX;
+  uint message_mask = ( 1u << dimension ) - 1;
+
+  //at most 2^16 received words, spread over all of them
+  uint step = code_length > 16 ? 1u << ( code_length - 16 ) : 1;
+  uint num_words = ( word_mask / step ) + 1;
+  vector< uint > received_words( num_words );
+  vector< uint > hadamard_words( num_words );
+  vector< uint > messages( num_words );
+  for( uint i = 0; i < num_words; i++ )
+  {
+    received_words[ i ] = i * step;
+  }
+
+  //the decoded batch is the one allocation allowed
+  begin_allocation_phase( "coding" );
+  vector< uint > decoded_words = code.decode_batch( received_words );
+  for( uint i = 0; i < num_words; i++ )
+  {
+    hadamard_words[ i ] = hadamard_decoder.decode_word( received_words[ i ] );
+    messages[ i ] = code.extract_message(
+      code.encode_word( received_words[ i ] & message_mask ) );
+  }
+  uint64_t num_allocations = get_phase_allocations();
+  num_allocations -= num_allocations > 0 ? 1 : 0;
+  begin_allocation_phase( "checking" );
+
+  uint num_wrong = 0;
+  for( uint i = 0; i < num_words; i++ )
+  {
+    if( !code.is_code_word( decoded_words[ i ] ) ||
+        !code.is_code_word( hadamard_words[ i ] ) ||
+        messages[ i ] != ( ( i * step ) & message_mask ) )
+    {
+      num_wrong++;
+    }
+  }
+
+  cout << "( " << code_length << ", " << dimension << " ) code, "
+       << num_words << " words: " << num_allocations
+       << " allocations, " << num_wrong << " wrong" << endl;
+  return num_allocations + num_wrong;
+}
+
+int main()
+{
+  //lengths and generator polynomials of codes through every decoder
+  //path: syndrome trapping, nearest neighbor fallback and the
+  //Hadamard transform
+  uint codes[][ 2 ] = { { 7, 0xB }, { 15, 0x13 }, { 15, 0x1D1 },
+                        { 15, 0x9AF }, { 23, 0xC75 } };
+  uint64_t num_failures = 0;
+  for( uint *code : codes )
+  {
+    num_failures += check_code( code[ 0 ], code[ 1 ] );
+  }
+
+  if( num_failures != 0 )
+  {
+    cout << "failed: the hot path allocated or coded wrongly." << endl;
+    return 1;
+  }
+  cout << "passed: the hot path made no allocations." << endl;
+  return 0;
+}
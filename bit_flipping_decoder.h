@@ -0,0 +1,238 @@
+#ifndef BIT_FLIPPING_DECODER_H
+#define BIT_FLIPPING_DECODER_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+
+using namespace std;
+
+/**
+ * A Gallager style bit flipping decoder for long cyclic codes. The
+ * parity checks are all n cyclic shifts of the parity check
+ * polynomial h(x) = ( x^n - 1 ) / g(x), so check j involves place i
+ * when h_( j - i ) = 1, and the checks involving place i are h(x)
+ * shifted by i. Each iteration counts the unsatisfied checks on
+ * every place with one popcount of the syndrome against that shift,
+ * flips the places with the most, and stops at a zero syndrome.
+ *
+ * Words are packed 32 bits to a uint, least significant bit first,
+ * so bit i of the packed word is the coefficient of x^i.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class BitFlippingDecoder
+{
+public:
+  /**
+   * Constructor specifying a cyclic code
+   * @param code_length the length of the code
+   * @param generator_polynomial g(x), packed
+   * @param max_iterations the number of flipping rounds allowed
+   */
+  BitFlippingDecoder( uint code_length,
+                      vector< uint > generator_polynomial,
+                      uint max_iterations );
+
+  /**
+   * Return the parity check polynomial h(x), packed
+   */
+  vector< uint > get_parity_polynomial() const;
+
+  /**
+   * compute the syndrome of a word against all n checks
+   * @param word the n bit word, packed
+   * @return the syndrome, bit j from check j, packed
+   */
+  vector< uint > get_syndrome( vector< uint > word ) const;
+
+  /**
+   * decode the received word
+   * @param received_word the n bit received word, packed
+   * @return the decoded word, which is the last word flipped to if
+   * the syndrome never reached zero
+   */
+  vector< uint > decode_word( vector< uint > received_word ) const;
+
+  /**
+   * flip places of the word until every check is satisfied
+   * @param word the n bit received word, packed
+   * @return whether the syndrome reached zero
+   */
+  bool correct_errors( vector< uint > &word ) const;
+
+private:
+
+  /**
+   * cyclically shift a packed word up one place
+   * @param word the word to be shifted
+   */
+  void shift_word( vector< uint > &word ) const;
+
+  vector< uint > parity_polynomial;
+  uint code_length;
+  uint num_packed;
+  uint last_mask;
+  uint max_iterations;
+};
+
+BitFlippingDecoder::BitFlippingDecoder( uint param_code_length,
+                                        vector< uint > generator_polynomial,
+                                        uint param_max_iterations )
+: code_length( param_code_length ),
+  max_iterations( param_max_iterations )
+{
+  num_packed = ( code_length + 31 ) / 32;
+  last_mask = code_length % 32 == 0 ? UINT_MAX
+    : ( 1u << ( code_length % 32 ) ) - 1;
+
+  //divide x^n - 1 by g(x), one coefficient at a time
+  vector< uint8_t > remainder( code_length + 1, 0 );
+  remainder.at( 0 ) = 1;
+  remainder.at( code_length ) = 1;
+  vector< uint8_t > divisor;
+  for( uint place_value = 0;
+       place_value < 32 * generator_polynomial.size(); place_value++ )
+  {
+    divisor.push_back( ( generator_polynomial.at( place_value / 32 )
+                         >> ( place_value % 32 ) ) & 1 );
+  }
+  while( !divisor.empty() && divisor.back() == 0 )
+  {
+    divisor.pop_back();
+  }
+  uint degree = divisor.size() - 1;
+
+  parity_polynomial.assign( num_packed, 0 );
+  for( uint place_value = code_length; place_value != degree - 1;
+       place_value-- )
+  {
+    if( remainder.at( place_value ) == 1 )
+    {
+      uint quotient_place = place_value - degree;
+      parity_polynomial.at( quotient_place / 32 ) |=
+        1u << ( quotient_place % 32 );
+      for( uint i = 0; i <= degree; i++ )
+      {
+        remainder.at( quotient_place + i ) ^= divisor.at( i );
+      }
+    }
+  }
+
+  for( uint place_value = 0; place_value < degree; place_value++ )
+  {
+    if( remainder.at( place_value ) != 0 )
+    {
+      cout << "g(x) does not divide x^n - 1." << endl;
+      break;
+    }
+  }
+}
+
+vector< uint > BitFlippingDecoder::get_parity_polynomial() const
+{
+  return parity_polynomial;
+}
+
+vector< uint > BitFlippingDecoder::get_syndrome( vector< uint > word ) const
+{
+  //check j is the coefficient of x^j in w(x) h(x) mod ( x^n - 1 ),
+  //which collects w_i for every i with h_( j - i ) = 1
+  vector< uint > syndrome( num_packed, 0 );
+  vector< uint > shifted_word = word;
+  for( uint shift = 0; shift < code_length; shift++ )
+  {
+    if( ( ( parity_polynomial.at( shift / 32 ) >> ( shift % 32 ) ) & 1 ) == 1 )
+    {
+      for( uint j = 0; j < num_packed; j++ )
+      {
+        syndrome.at( j ) ^= shifted_word.at( j );
+      }
+    }
+    shift_word( shifted_word );
+  }
+  return syndrome;
+}
+
+vector< uint > BitFlippingDecoder::decode_word(
+  vector< uint > received_word ) const
+{
+  correct_errors( received_word );
+  return received_word;
+}
+
+bool BitFlippingDecoder::correct_errors( vector< uint > &word ) const
+{
+  vector< uint > syndrome = get_syndrome( word );
+  vector< uint > counts( code_length );
+  vector< uint > checks( num_packed );
+
+  for( uint iteration = 0; iteration <= max_iterations; iteration++ )
+  {
+    bool satisfied = true;
+    for( uint j = 0; j < num_packed; j++ )
+    {
+      satisfied = satisfied && syndrome.at( j ) == 0;
+    }
+    if( satisfied )
+    {
+      return true;
+    }
+    if( iteration == max_iterations )
+    {
+      break;
+    }
+
+    //the checks involving place i are h(x) shifted by i; count the
+    //unsatisfied ones with a popcount per packed word
+    checks = parity_polynomial;
+    uint most_unsatisfied = 0;
+    for( uint place_value = 0; place_value < code_length; place_value++ )
+    {
+      uint unsatisfied = 0;
+      for( uint j = 0; j < num_packed; j++ )
+      {
+        unsatisfied += __builtin_popcount( syndrome.at( j ) & checks.at( j ) );
+      }
+      counts.at( place_value ) = unsatisfied;
+      most_unsatisfied = unsatisfied > most_unsatisfied ?
+        unsatisfied : most_unsatisfied;
+      shift_word( checks );
+    }
+
+    //flip every place with the most unsatisfied checks, updating
+    //the syndrome by the checks the place is in
+    checks = parity_polynomial;
+    for( uint place_value = 0; place_value < code_length; place_value++ )
+    {
+      if( counts.at( place_value ) == most_unsatisfied )
+      {
+        word.at( place_value / 32 ) ^= 1u << ( place_value % 32 );
+        for( uint j = 0; j < num_packed; j++ )
+        {
+          syndrome.at( j ) ^= checks.at( j );
+        }
+      }
+      shift_word( checks );
+    }
+  }
+  return false;
+}
+
+void BitFlippingDecoder::shift_word( vector< uint > &word ) const
+{
+  //the place n - 1 wraps around to place 0
+  uint top_place = code_length - 1;
+  uint wrapped_bit = ( word.at( top_place / 32 ) >> ( top_place % 32 ) ) & 1;
+  uint carry = wrapped_bit;
+  for( uint j = 0; j < num_packed; j++ )
+  {
+    uint next_carry = word.at( j ) >> 31;
+    word.at( j ) = ( word.at( j ) << 1 ) | carry;
+    carry = next_carry;
+  }
+  word.at( num_packed - 1 ) &= last_mask;
+}
+
+#endif
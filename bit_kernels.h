@@ -0,0 +1,551 @@
+#ifndef BIT_KERNELS_H
+#define BIT_KERNELS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <immintrin.h>
+#include "cpu_features.h"
+
+using namespace std;
+
+/**
+ * Hamming weight and distance kernels. Each has a portable version,
+ * which gives the same results on every host, and versions compiled
+ * for POPCNT, AVX2 and AVX-512 VPOPCNTDQ with target attributes, so
+ * one binary carries them all. The best one the processor supports,
+ * by get_cpu_features, is chosen the first time a kernel is called.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+
+/**
+ * count the ones in a word without special instructions
+ * @param word the word
+ * @return the number of ones
+ */
+uint word_weight_portable( uint word )
+{
+  word = word - ( ( word >> 1 ) & 0x55555555 );
+  word = ( word & 0x33333333 ) + ( ( word >> 2 ) & 0x33333333 );
+  word = ( word + ( word >> 4 ) ) & 0x0F0F0F0F;
+  return ( word * 0x01010101 ) >> 24;
+}
+
+/**
+ * count the ones in a 64 bit word without special instructions
+ */
+uint64_t long_weight_portable( uint64_t word )
+{
+  word = word - ( ( word >> 1 ) & 0x5555555555555555ULL );
+  word = ( word & 0x3333333333333333ULL ) +
+    ( ( word >> 2 ) & 0x3333333333333333ULL );
+  word = ( word + ( word >> 4 ) ) & 0x0F0F0F0F0F0F0F0FULL;
+  return ( word * 0x0101010101010101ULL ) >> 56;
+}
+
+/**
+ * add three words bit by bit, a carry save adder
+ * @param high the carries
+ * @param low the sums
+ */
+void carry_save_add( uint64_t &high, uint64_t &low, uint64_t first,
+                     uint64_t second, uint64_t third )
+{
+  uint64_t partial = first ^ second;
+  high = ( first & second ) | ( partial & third );
+  low = partial ^ third;
+}
+
+/**
+ * count the ones in an array of words portably, with the
+ * Harley-Seal method: sixteen 64 bit words at a time are reduced by
+ * carry save adders to a word of sixteens, and only that is counted
+ * @param words the words
+ * @param count the number of words
+ * @return the number of ones
+ */
+uint64_t array_weight_portable( const uint *words, size_t count )
+{
+  uint64_t total = 0;
+  uint64_t ones = 0;
+  uint64_t twos = 0;
+  uint64_t fours = 0;
+  uint64_t eights = 0;
+  uint64_t sixteens = 0;
+  uint64_t twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;
+  const size_t BLOCK = 32;
+  size_t i = 0;
+  for( ; i + BLOCK <= count; i += BLOCK )
+  {
+    uint64_t longs[ 16 ];
+    for( uint j = 0; j < 16; j++ )
+    {
+      longs[ j ] = words[ i + 2 * j ] |
+        ( uint64_t( words[ i + 2 * j + 1 ] ) << 32 );
+    }
+    carry_save_add( twos_a, ones, ones, longs[ 0 ], longs[ 1 ] );
+    carry_save_add( twos_b, ones, ones, longs[ 2 ], longs[ 3 ] );
+    carry_save_add( fours_a, twos, twos, twos_a, twos_b );
+    carry_save_add( twos_a, ones, ones, longs[ 4 ], longs[ 5 ] );
+    carry_save_add( twos_b, ones, ones, longs[ 6 ], longs[ 7 ] );
+    carry_save_add( fours_b, twos, twos, twos_a, twos_b );
+    carry_save_add( eights_a, fours, fours, fours_a, fours_b );
+    carry_save_add( twos_a, ones, ones, longs[ 8 ], longs[ 9 ] );
+    carry_save_add( twos_b, ones, ones, longs[ 10 ], longs[ 11 ] );
+    carry_save_add( fours_a, twos, twos, twos_a, twos_b );
+    carry_save_add( twos_a, ones, ones, longs[ 12 ], longs[ 13 ] );
+    carry_save_add( twos_b, ones, ones, longs[ 14 ], longs[ 15 ] );
+    carry_save_add( fours_b, twos, twos, twos_a, twos_b );
+    carry_save_add( eights_b, fours, fours, fours_a, fours_b );
+    carry_save_add( sixteens, eights, eights, eights_a, eights_b );
+    total += long_weight_portable( sixteens );
+  }
+  total = 16 * total + 8 * long_weight_portable( eights ) +
+    4 * long_weight_portable( fours ) + 2 * long_weight_portable( twos ) +
+    long_weight_portable( ones );
+  for( ; i < count; i++ )
+  {
+    total += word_weight_portable( words[ i ] );
+  }
+  return total;
+}
+
+/**
+ * find the distance from a word to each word of an array portably
+ * @param word the word
+ * @param words the words to compare with
+ * @param count the number of words
+ * @param distances the distances, one byte each
+ */
+void word_distances_portable( uint word, const uint *words, size_t count,
+                              uint8_t *distances )
+{
+  for( size_t i = 0; i < count; i++ )
+  {
+    distances[ i ] = word_weight_portable( word ^ words[ i ] );
+  }
+}
+
+/**
+ * find the word of an array nearest a given word portably, the
+ * first of the nearest if there are several
+ * @param word the word
+ * @param words the words to compare with
+ * @param count the number of words
+ * @param distance set to the least distance, or UINT_MAX if there
+ * are no words
+ * @return the index of the nearest word
+ */
+size_t nearest_word_portable( uint word, const uint *words, size_t count,
+                              uint &distance )
+{
+  size_t nearest = 0;
+  distance = UINT_MAX;
+  for( size_t i = 0; i < count; i++ )
+  {
+    uint this_distance = word_weight_portable( word ^ words[ i ] );
+    if( this_distance < distance )
+    {
+      distance = this_distance;
+      nearest = i;
+    }
+  }
+  return nearest;
+}
+
+__attribute__(( target( "popcnt" ) ))
+uint word_weight_popcnt( uint word )
+{
+  return __builtin_popcount( word );
+}
+
+__attribute__(( target( "popcnt" ) ))
+uint64_t array_weight_popcnt( const uint *words, size_t count )
+{
+  uint64_t total = 0;
+  size_t i = 0;
+  for( ; i + 2 <= count; i += 2 )
+  {
+    total += __builtin_popcountll( words[ i ] |
+                                   ( uint64_t( words[ i + 1 ] ) << 32 ) );
+  }
+  for( ; i < count; i++ )
+  {
+    total += __builtin_popcount( words[ i ] );
+  }
+  return total;
+}
+
+__attribute__(( target( "popcnt" ) ))
+void word_distances_popcnt( uint word, const uint *words, size_t count,
+                            uint8_t *distances )
+{
+  for( size_t i = 0; i < count; i++ )
+  {
+    distances[ i ] = __builtin_popcount( word ^ words[ i ] );
+  }
+}
+
+__attribute__(( target( "popcnt" ) ))
+size_t nearest_word_popcnt( uint word, const uint *words, size_t count,
+                            uint &distance )
+{
+  size_t nearest = 0;
+  distance = UINT_MAX;
+  for( size_t i = 0; i < count; i++ )
+  {
+    uint this_distance = __builtin_popcount( word ^ words[ i ] );
+    if( this_distance < distance )
+    {
+      distance = this_distance;
+      nearest = i;
+    }
+  }
+  return nearest;
+}
+
+/**
+ * count the ones in each byte of eight words with a nibble table
+ * lookup, then sum the four bytes of each word
+ */
+__attribute__(( target( "avx2" ) ))
+__m256i word_weights_avx2( __m256i words )
+{
+  const __m256i NIBBLE_WEIGHTS = _mm256_setr_epi8(
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 );
+  const __m256i LOW_NIBBLES = _mm256_set1_epi8( 0x0F );
+  __m256i low = _mm256_and_si256( words, LOW_NIBBLES );
+  __m256i high = _mm256_and_si256( _mm256_srli_epi16( words, 4 ),
+                                   LOW_NIBBLES );
+  __m256i byte_weights = _mm256_add_epi8(
+    _mm256_shuffle_epi8( NIBBLE_WEIGHTS, low ),
+    _mm256_shuffle_epi8( NIBBLE_WEIGHTS, high ) );
+  return _mm256_madd_epi16(
+    _mm256_maddubs_epi16( byte_weights, _mm256_set1_epi8( 1 ) ),
+    _mm256_set1_epi16( 1 ) );
+}
+
+__attribute__(( target( "avx2" ) ))
+uint64_t array_weight_avx2( const uint *words, size_t count )
+{
+  __m256i totals = _mm256_setzero_si256();
+  size_t i = 0;
+  for( ; i + 8 <= count; i += 8 )
+  {
+    __m256i block = _mm256_loadu_si256(
+      reinterpret_cast< const __m256i * >( words + i ) );
+    //each word's weight is in its low byte, so summing bytes sums
+    //the weights
+    totals = _mm256_add_epi64( totals, _mm256_sad_epu8(
+      word_weights_avx2( block ), _mm256_setzero_si256() ) );
+  }
+  uint64_t lanes[ 4 ];
+  _mm256_storeu_si256( reinterpret_cast< __m256i * >( lanes ), totals );
+  uint64_t total = lanes[ 0 ] + lanes[ 1 ] + lanes[ 2 ] + lanes[ 3 ];
+  for( ; i < count; i++ )
+  {
+    total += word_weight_portable( words[ i ] );
+  }
+  return total;
+}
+
+__attribute__(( target( "avx2" ) ))
+void word_distances_avx2( uint word, const uint *words, size_t count,
+                          uint8_t *distances )
+{
+  __m256i received = _mm256_set1_epi32( word );
+  size_t i = 0;
+  for( ; i + 8 <= count; i += 8 )
+  {
+    __m256i block = _mm256_loadu_si256(
+      reinterpret_cast< const __m256i * >( words + i ) );
+    uint weights[ 8 ];
+    _mm256_storeu_si256( reinterpret_cast< __m256i * >( weights ),
+      word_weights_avx2( _mm256_xor_si256( block, received ) ) );
+    for( uint j = 0; j < 8; j++ )
+    {
+      distances[ i + j ] = weights[ j ];
+    }
+  }
+  word_distances_portable( word, words + i, count - i, distances + i );
+}
+
+/**
+ * finish a vector search for the nearest word: the least distance
+ * over the lanes, the least index among lanes with that distance,
+ * then the words left over after the last full vector
+ */
+size_t finish_nearest_word( const uint *lane_distances,
+                            const uint *lane_indices, uint num_lanes,
+                            uint word, const uint *words, size_t first,
+                            size_t count, uint &distance )
+{
+  size_t nearest = 0;
+  distance = UINT_MAX;
+  for( uint lane = 0; lane < num_lanes; lane++ )
+  {
+    if( lane_distances[ lane ] < distance ||
+        ( lane_distances[ lane ] == distance &&
+          lane_indices[ lane ] < nearest ) )
+    {
+      distance = lane_distances[ lane ];
+      nearest = lane_indices[ lane ];
+    }
+  }
+  uint rest_distance;
+  size_t rest = nearest_word_portable( word, words + first, count - first,
+                                       rest_distance );
+  if( rest_distance < distance )
+  {
+    distance = rest_distance;
+    nearest = first + rest;
+  }
+  return nearest;
+}
+
+__attribute__(( target( "avx2" ) ))
+size_t nearest_word_avx2( uint word, const uint *words, size_t count,
+                          uint &distance )
+{
+  //each lane keeps the least distance it has seen and where, taking
+  //a new word only when strictly nearer so the first one is kept
+  __m256i received = _mm256_set1_epi32( word );
+  __m256i best_distances = _mm256_set1_epi32( INT_MAX );
+  __m256i best_indices = _mm256_setzero_si256();
+  __m256i indices = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+  const __m256i STEP = _mm256_set1_epi32( 8 );
+  size_t i = 0;
+  for( ; i + 8 <= count && i + 8 <= INT_MAX; i += 8 )
+  {
+    __m256i distances = word_weights_avx2( _mm256_xor_si256(
+      _mm256_loadu_si256( reinterpret_cast< const __m256i * >( words + i ) ),
+      received ) );
+    __m256i nearer = _mm256_cmpgt_epi32( best_distances, distances );
+    best_distances = _mm256_blendv_epi8( best_distances, distances, nearer );
+    best_indices = _mm256_blendv_epi8( best_indices, indices, nearer );
+    indices = _mm256_add_epi32( indices, STEP );
+  }
+  uint lane_distances[ 8 ];
+  uint lane_indices[ 8 ];
+  _mm256_storeu_si256( reinterpret_cast< __m256i * >( lane_distances ),
+                       best_distances );
+  _mm256_storeu_si256( reinterpret_cast< __m256i * >( lane_indices ),
+                       best_indices );
+  return finish_nearest_word( lane_distances, lane_indices, i == 0 ? 0 : 8,
+                              word, words, i, count, distance );
+}
+
+__attribute__(( target( "avx512f,avx512vpopcntdq" ) ))
+uint64_t array_weight_avx512( const uint *words, size_t count )
+{
+  //a lane gains at most 32 a step, so the lanes are summed into the
+  //total every 2^20 steps, well before they could overflow
+  const size_t CHUNK = size_t( 16 ) << 20;
+  uint64_t total = 0;
+  size_t i = 0;
+  while( i + 16 <= count )
+  {
+    size_t chunk_end = count - i > CHUNK ? i + CHUNK : count;
+    __m512i totals = _mm512_setzero_si512();
+    for( ; i + 16 <= chunk_end; i += 16 )
+    {
+      totals = _mm512_add_epi32( totals, _mm512_popcnt_epi32(
+        _mm512_loadu_si512( words + i ) ) );
+    }
+    uint lane_totals[ 16 ];
+    _mm512_storeu_si512( lane_totals, totals );
+    for( uint lane = 0; lane < 16; lane++ )
+    {
+      total += lane_totals[ lane ];
+    }
+  }
+  for( ; i < count; i++ )
+  {
+    total += __builtin_popcount( words[ i ] );
+  }
+  return total;
+}
+
+__attribute__(( target( "avx512f,avx512vpopcntdq" ) ))
+void word_distances_avx512( uint word, const uint *words, size_t count,
+                            uint8_t *distances )
+{
+  __m512i received = _mm512_set1_epi32( word );
+  size_t i = 0;
+  for( ; i + 16 <= count; i += 16 )
+  {
+    __m512i weights = _mm512_popcnt_epi32(
+      _mm512_xor_si512( _mm512_loadu_si512( words + i ), received ) );
+    _mm512_mask_cvtepi32_storeu_epi8( distances + i, 0xFFFF, weights );
+  }
+  word_distances_portable( word, words + i, count - i, distances + i );
+}
+
+__attribute__(( target( "avx512f,avx512vpopcntdq" ) ))
+size_t nearest_word_avx512( uint word, const uint *words, size_t count,
+                            uint &distance )
+{
+  __m512i received = _mm512_set1_epi32( word );
+  __m512i best_distances = _mm512_set1_epi32( INT_MAX );
+  __m512i best_indices = _mm512_setzero_si512();
+  __m512i indices = _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7,
+                                       8, 9, 10, 11, 12, 13, 14, 15 );
+  const __m512i STEP = _mm512_set1_epi32( 16 );
+  size_t i = 0;
+  for( ; i + 16 <= count && i + 16 <= INT_MAX; i += 16 )
+  {
+    __m512i distances = _mm512_popcnt_epi32(
+      _mm512_xor_si512( _mm512_loadu_si512( words + i ), received ) );
+    __mmask16 nearer = _mm512_cmplt_epu32_mask( distances, best_distances );
+    best_distances = _mm512_mask_mov_epi32( best_distances, nearer,
+                                            distances );
+    best_indices = _mm512_mask_mov_epi32( best_indices, nearer, indices );
+    indices = _mm512_add_epi32( indices, STEP );
+  }
+  uint lane_distances[ 16 ];
+  uint lane_indices[ 16 ];
+  _mm512_storeu_si512( lane_distances, best_distances );
+  _mm512_storeu_si512( lane_indices, best_indices );
+  return finish_nearest_word( lane_distances, lane_indices, i == 0 ? 0 : 16,
+                              word, words, i, count, distance );
+}
+
+/**
+ * The weight kernels chosen for this processor
+ */
+struct WeightKernels
+{
+  uint ( *word_weight )( uint );
+  uint64_t ( *array_weight )( const uint *, size_t );
+  void ( *word_distances )( uint, const uint *, size_t, uint8_t * );
+  size_t ( *nearest_word )( uint, const uint *, size_t, uint & );
+
+  WeightKernels()
+  : word_weight( word_weight_portable ),
+    array_weight( array_weight_portable ),
+    word_distances( word_distances_portable ),
+    nearest_word( nearest_word_portable )
+  {
+    const CpuFeatures &features = get_cpu_features();
+    if( features.popcnt )
+    {
+      word_weight = word_weight_popcnt;
+      array_weight = array_weight_popcnt;
+      word_distances = word_distances_popcnt;
+      nearest_word = nearest_word_popcnt;
+    }
+    if( features.avx2 )
+    {
+      array_weight = array_weight_avx2;
+      word_distances = word_distances_avx2;
+      nearest_word = nearest_word_avx2;
+    }
+    if( features.avx512vpopcntdq )
+    {
+      array_weight = array_weight_avx512;
+      word_distances = word_distances_avx512;
+      nearest_word = nearest_word_avx512;
+    }
+  }
+};
+
+/**
+ * Return the kernels, choosing them on the first call
+ */
+const WeightKernels &get_weight_kernels()
+{
+  static const WeightKernels kernels;
+  return kernels;
+}
+
+/**
+ * count the ones in a word
+ */
+uint word_weight( uint word )
+{
+  return get_weight_kernels().word_weight( word );
+}
+
+/**
+ * count the ones in an array of words
+ */
+uint64_t array_weight( const uint *words, size_t count )
+{
+  return get_weight_kernels().array_weight( words, count );
+}
+
+/**
+ * find the distance from a word to each word of an array
+ */
+void word_distances( uint word, const uint *words, size_t count,
+                     uint8_t *distances )
+{
+  get_weight_kernels().word_distances( word, words, count, distances );
+}
+
+/**
+ * find the word of an array nearest a given word, the first of the
+ * nearest if there are several
+ * @param word the word
+ * @param words the words to compare with
+ * @param count the number of words
+ * @param distance set to the least distance
+ * @return the index of the nearest word
+ */
+size_t nearest_word( uint word, const uint *words, size_t count,
+                     uint &distance )
+{
+  return get_weight_kernels().nearest_word( word, words, count, distance );
+}
+
+/**
+ * find the nearest word of an array for each of a batch of words.
+ * The array is taken a tile at a time, small enough to stay in the
+ * L1 cache while a block of the batch is compared against it; the
+ * running least distances of the block are kept on the stack, so
+ * the search never allocates
+ * @param received_words the words of the batch
+ * @param num_received the number of words in the batch
+ * @param words the words to compare with
+ * @param count the number of words to compare with
+ * @param nearest set to the index of the nearest word for each word
+ * of the batch
+ */
+void nearest_words( const uint *received_words, size_t num_received,
+                    const uint *words, size_t count, size_t *nearest )
+{
+  const size_t TILE = 4096;
+  const size_t BLOCK = 256;
+  uint distances[ BLOCK ];
+  for( size_t block = 0; block < num_received; block += BLOCK )
+  {
+    size_t block_size =
+      num_received - block < BLOCK ? num_received - block : BLOCK;
+    for( size_t i = 0; i < block_size; i++ )
+    {
+      distances[ i ] = UINT_MAX;
+      nearest[ block + i ] = 0;
+    }
+    for( size_t first = 0; first < count; first += TILE )
+    {
+      size_t tile_size = count - first < TILE ? count - first : TILE;
+      for( size_t i = 0; i < block_size; i++ )
+      {
+        uint distance;
+        size_t index = nearest_word( received_words[ block + i ],
+                                     words + first, tile_size, distance );
+        if( distance < distances[ i ] )
+        {
+          distances[ i ] = distance;
+          nearest[ block + i ] = first + index;
+        }
+      }
+    }
+  }
+}
+
+#endif
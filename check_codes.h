@@ -0,0 +1,68 @@
+#ifndef CHECK_CODES_H
+#define CHECK_CODES_H
+
+#include <cstdint>
+#include <vector>
+#include <climits>
+
+using namespace std;
+
+/**
+ * The construction of cyclic codes for the check programs, which
+ * need codes without reading them in through the driver.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+
+/**
+ * build the generator and parity check matrices of the cyclic code
+ * of a length and generator polynomial: the generator matrix of the
+ * driver and its (I_n-k|A) parity check matrix, whose column for
+ * place i is x^( n - 1 - i ) mod g(x)
+ * @param code_length the length of the code
+ * @param generator_polynomial g(x), bit i the coefficient of x^i
+ * @param generator set to the generator matrix
+ * @param parity_check set to the parity check matrix
+ */
+void build_matrices( uint code_length, uint generator_polynomial,
+                     vector< uint > &generator,
+                     vector< uint > &parity_check )
+{
+  uint degree = 31 - __builtin_clz( generator_polynomial );
+
+  //the rows x^j g*( x ) of the generator matrix, as in the driver
+  uint reverse_generator = 0;
+  for( uint i = 0; i <= degree; i++ )
+  {
+    if( ( ( generator_polynomial >> i ) & 1 ) == 1 )
+    {
+      reverse_generator |= 1u << ( degree - i );
+    }
+  }
+  generator.clear();
+  for( uint i = code_length - degree - 1; i != UINT_MAX; i-- )
+  {
+    generator.push_back( reverse_generator << i );
+  }
+
+  parity_check.assign( degree, 0 );
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    //reduce x^( n - 1 - i ) mod g(x)
+    uint column = 1;
+    for( uint power = 0; power < code_length - 1 - place_value; power++ )
+    {
+      column <<= 1;
+      if( ( ( column >> degree ) & 1 ) == 1 )
+      {
+        column ^= generator_polynomial;
+      }
+    }
+    for( uint row = 0; row < degree; row++ )
+    {
+      parity_check.at( row ) |= ( ( column >> row ) & 1 ) << place_value;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,466 @@
+#ifndef CODE_TRANSFORMS_H
+#define CODE_TRANSFORMS_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include "cyclic_codes.h"
+
+using namespace std;
+
+/**
+ * A code shortened from a cyclic code by s places. The code words
+ * are the parent code words whose s highest places are zero, with
+ * those places removed, so a shortened word is decoded by the
+ * parent decoder as it stands.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class ShortenedCode
+{
+public:
+  /**
+   * Constructor specifying the parent code and number of places
+   * @param parent the cyclic code to be shortened
+   * @param shortened_places the number of places s to remove, less
+   * than the dimension of the parent; more is rejected, leaving a
+   * code of length 0
+   */
+  ShortenedCode( const CyclicCode &parent, uint shortened_places );
+
+  /**
+   * Return the code length n - s, or 0 if the shortening was rejected
+   */
+  uint get_code_length() const;
+
+  /**
+   * Return the code words
+   */
+  vector< uint > get_code_words() const;
+
+  /**
+   * determine if the word is part of the code
+   * @param word the word to be checked
+   * @return if it is a word or not
+   */
+  bool is_code_word( uint word ) const;
+
+  /**
+   * encode the word with the parent code
+   * @param word the word to be encoded, of k - s places
+   * @return the encoded word
+   */
+  uint encode_word( uint word ) const;
+
+  /**
+   * decode the word with the parent decoder
+   * @param received_word the word to be decoded
+   * @return the decoded word, or the received word if the parent
+   * decoder places an error in a removed place
+   */
+  uint decode_word( uint received_word ) const;
+
+private:
+
+  const CyclicCode &parent;
+  uint shortened_places;
+  uint code_length;
+  uint word_mask;
+  bool shortenable;
+};
+
+/**
+ * A code punctured from a cyclic code by deleting the places in a
+ * mask. A received word is decoded by filling the deleted places
+ * every possible way, decoding each with the parent decoder, and
+ * keeping the result nearest the received word in the remaining
+ * places.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class PuncturedCode
+{
+public:
+  /**
+   * Constructor specifying the parent code and punctured places
+   * @param parent the cyclic code to be punctured
+   * @param punctured_places a mask of the places to delete
+   */
+  PuncturedCode( const CyclicCode &parent, uint punctured_places );
+
+  /**
+   * Return the code length n - p
+   */
+  uint get_code_length() const;
+
+  /**
+   * Return the code words
+   */
+  vector< uint > get_code_words() const;
+
+  /**
+   * determine if the word is part of the code
+   * @param word the word to be checked
+   * @return if it is a word or not
+   */
+  bool is_code_word( uint word ) const;
+
+  /**
+   * encode the word with the parent code and puncture it
+   * @param word the word to be encoded
+   * @return the encoded word
+   */
+  uint encode_word( uint word ) const;
+
+  /**
+   * decode the word with the parent decoder
+   * @param received_word the word to be decoded
+   * @return the decoded word
+   */
+  uint decode_word( uint received_word ) const;
+
+private:
+
+  /**
+   * delete the punctured places of a parent word
+   * @param word the parent word
+   * @return the punctured word
+   */
+  uint puncture( uint word ) const;
+
+  /**
+   * insert values into the punctured places of a word
+   * @param word the punctured word
+   * @param filling the values, one bit per punctured place
+   * @return the parent word
+   */
+  uint depuncture( uint word, uint filling ) const;
+
+  const CyclicCode &parent;
+  vector< uint > kept_places;
+  vector< uint > punctured_place_values;
+  uint code_length;
+};
+
+/**
+ * A code extended from a cyclic code by an overall parity bit in
+ * place n, so that every code word has even weight. An odd minimum
+ * distance d becomes d + 1, so the code still corrects ( d - 1 ) / 2
+ * errors and also detects one more.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class ExtendedCode
+{
+public:
+  /**
+   * Constructor specifying the parent code
+   * @param parent the cyclic code to be extended, of length < 32; a
+   * longer code is rejected, leaving a code of length 0
+   */
+  ExtendedCode( const CyclicCode &parent );
+
+  /**
+   * Return the code length n + 1, or 0 if the parent was rejected
+   */
+  uint get_code_length() const;
+
+  /**
+   * Return the code words
+   */
+  vector< uint > get_code_words() const;
+
+  /**
+   * determine if the word is part of the code
+   * @param word the word to be checked
+   * @return if it is a word or not
+   */
+  bool is_code_word( uint word ) const;
+
+  /**
+   * encode the word with the parent code and add the parity bit
+   * @param word the word to be encoded
+   * @return the encoded word
+   */
+  uint encode_word( uint word ) const;
+
+  /**
+   * decode the first n places with the parent decoder and
+   * recompute the parity bit
+   * @param received_word the word to be decoded
+   * @return the decoded word, or the received word if the decoding
+   * changes more places than the code corrects, as when the parity
+   * bit shows an even number of errors the parent took for odd
+   */
+  uint decode_word( uint received_word ) const;
+
+private:
+
+  /**
+   * add the overall parity bit to a parent word
+   * @param word the parent word
+   * @return the extended word
+   */
+  uint extend( uint word ) const;
+
+  const CyclicCode &parent;
+  uint parent_mask;
+  uint correctable_weight;
+  bool extendable;
+};
+
+ShortenedCode::ShortenedCode( const CyclicCode &param_parent,
+                              uint param_shortened_places )
+: parent( param_parent ), shortened_places( param_shortened_places ),
+  code_length( 0 ), word_mask( 0 ), shortenable( false )
+{
+  if( shortened_places >= parent.get_generator().size() )
+  {
+    cout << "cannot shorten by the dimension of the code or more."
+         << endl;
+    return;
+  }
+  code_length = parent.get_code_length() - shortened_places;
+  word_mask = ( 1u << code_length ) - 1;
+  shortenable = true;
+}
+
+uint ShortenedCode::get_code_length() const
+{
+  return code_length;
+}
+
+vector< uint > ShortenedCode::get_code_words() const
+{
+  vector< uint > code_words;
+  for( uint word : parent.get_code_words() )
+  {
+    if( shortenable && ( word & ~word_mask ) == 0 )
+    {
+      code_words.push_back( word );
+    }
+  }
+  return code_words;
+}
+
+bool ShortenedCode::is_code_word( uint word ) const
+{
+  return shortenable && ( word & ~word_mask ) == 0 &&
+    parent.is_code_word( word );
+}
+
+uint ShortenedCode::encode_word( uint word ) const
+{
+  if( !shortenable )
+  {
+    return 0;
+  }
+
+  //the rows of the parent generator are x^i g(x), so messages of
+  //k - s places encode to words with the s highest places zero
+  uint dimension = parent.get_generator().size() - shortened_places;
+  uint message_mask = ( 1u << dimension ) - 1;
+  return parent.encode_word( word & message_mask );
+}
+
+uint ShortenedCode::decode_word( uint received_word ) const
+{
+  if( !shortenable )
+  {
+    return 0;
+  }
+
+  //the removed places are known to be zero
+  uint decoded_word = parent.decode_word( received_word & word_mask );
+  if( ( decoded_word & ~word_mask ) != 0 )
+  {
+    return received_word;
+  }
+  return decoded_word;
+}
+
+PuncturedCode::PuncturedCode( const CyclicCode &param_parent,
+                              uint punctured_places )
+: parent( param_parent )
+{
+  //remember which parent places remain and which are deleted
+  for( uint place_value = 0; place_value < parent.get_code_length();
+       place_value++ )
+  {
+    if( ( ( punctured_places >> place_value ) & 1 ) == 1 )
+    {
+      punctured_place_values.push_back( place_value );
+    }
+    else
+    {
+      kept_places.push_back( place_value );
+    }
+  }
+  code_length = kept_places.size();
+}
+
+uint PuncturedCode::get_code_length() const
+{
+  return code_length;
+}
+
+vector< uint > PuncturedCode::get_code_words() const
+{
+  vector< uint > code_words;
+  for( uint word : parent.get_code_words() )
+  {
+    code_words.push_back( puncture( word ) );
+  }
+
+  //puncturing past the minimum distance may merge code words
+  sort( code_words.begin(), code_words.end() );
+  code_words.erase( unique( code_words.begin(), code_words.end() ),
+                    code_words.end() );
+  return code_words;
+}
+
+bool PuncturedCode::is_code_word( uint word ) const
+{
+  for( uint filling = 0;
+       filling < ( 1u << punctured_place_values.size() ); filling++ )
+  {
+    if( parent.is_code_word( depuncture( word, filling ) ) )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint PuncturedCode::encode_word( uint word ) const
+{
+  return puncture( parent.encode_word( word ) );
+}
+
+uint PuncturedCode::decode_word( uint received_word ) const
+{
+  //try every filling of the deleted places and keep the decoding
+  //nearest the received word where it was actually received
+  uint decoded_word = received_word;
+  uint least_distance = UINT_MAX;
+  for( uint filling = 0;
+       filling < ( 1u << punctured_place_values.size() ); filling++ )
+  {
+    uint candidate = puncture(
+      parent.decode_word( depuncture( received_word, filling ) ) );
+    uint distance = __builtin_popcount( candidate ^ received_word );
+    if( distance < least_distance )
+    {
+      least_distance = distance;
+      decoded_word = candidate;
+    }
+  }
+  return decoded_word;
+}
+
+uint PuncturedCode::puncture( uint word ) const
+{
+  uint punctured_word = 0;
+  for( uint i = 0; i < kept_places.size(); i++ )
+  {
+    punctured_word |= ( ( word >> kept_places.at( i ) ) & 1 ) << i;
+  }
+  return punctured_word;
+}
+
+uint PuncturedCode::depuncture( uint word, uint filling ) const
+{
+  uint parent_word = 0;
+  for( uint i = 0; i < kept_places.size(); i++ )
+  {
+    parent_word |= ( ( word >> i ) & 1 ) << kept_places.at( i );
+  }
+  for( uint i = 0; i < punctured_place_values.size(); i++ )
+  {
+    parent_word |= ( ( filling >> i ) & 1 )
+      << punctured_place_values.at( i );
+  }
+  return parent_word;
+}
+
+ExtendedCode::ExtendedCode( const CyclicCode &param_parent )
+: parent( param_parent ), parent_mask( 0 ), correctable_weight( 0 ),
+  extendable( false )
+{
+  //the parity bit goes in place n, which must fit in a uint
+  uint parent_length = parent.get_code_length();
+  if( parent_length >= 32 )
+  {
+    cout << "cannot extend a code of length 32 or more." << endl;
+    return;
+  }
+  parent_mask = ( 1u << parent_length ) - 1;
+  uint distance = parent.get_min_distance();
+  distance += distance % 2;
+  correctable_weight = ( distance - 1 ) / 2;
+  extendable = true;
+}
+
+uint ExtendedCode::get_code_length() const
+{
+  return extendable ? parent.get_code_length() + 1 : 0;
+}
+
+vector< uint > ExtendedCode::get_code_words() const
+{
+  vector< uint > code_words;
+  for( uint word : parent.get_code_words() )
+  {
+    if( extendable )
+    {
+      code_words.push_back( extend( word ) );
+    }
+  }
+  return code_words;
+}
+
+bool ExtendedCode::is_code_word( uint word ) const
+{
+  return extendable && parent.is_code_word( word & parent_mask ) &&
+    __builtin_popcount( word ) % 2 == 0;
+}
+
+uint ExtendedCode::encode_word( uint word ) const
+{
+  if( !extendable )
+  {
+    return 0;
+  }
+  return extend( parent.encode_word( word ) );
+}
+
+uint ExtendedCode::decode_word( uint received_word ) const
+{
+  if( !extendable )
+  {
+    return 0;
+  }
+  uint decoded_word =
+    extend( parent.decode_word( received_word & parent_mask ) );
+
+  //the parity bit counts the errors mod 2, so an even number the
+  //parent decoded as odd needs the parity bit flipped as well,
+  //past the weight the extended code corrects
+  uint word_mask = ( parent_mask << 1 ) | 1;
+  uint changed_places = ( decoded_word ^ received_word ) & word_mask;
+  if( uint( __builtin_popcount( changed_places ) ) > correctable_weight )
+  {
+    return received_word;
+  }
+  return decoded_word;
+}
+
+uint ExtendedCode::extend( uint word ) const
+{
+  uint parity_bit = __builtin_popcount( word ) & 1;
+  return word | ( parity_bit << parent.get_code_length() );
+}
+
+#endif
@@ -0,0 +1,337 @@
+#ifndef COMPACT_SYNDROME_TABLE_H
+#define COMPACT_SYNDROME_TABLE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include "cyclic_codes.h"
+
+using namespace std;
+
+/**
+ * A bounded distance decoding table holding only the syndromes of
+ * errors of weight at most t = ( d - 1 ) / 2, rather than all
+ * 2^( n - k ) of them. The syndromes are kept sorted in Eytzinger
+ * order, the order of a breadth first walk of a balanced search
+ * tree, so a lookup touches one cache line per level near the root
+ * and the next levels can be prefetched. Syndromes and errors are
+ * each stored in the narrowest of 1, 2 or 4 bytes holding n - k and
+ * n bits. When the correctable syndromes are most of them, as for a
+ * perfect code, the errors are instead indexed by syndrome directly,
+ * whichever takes less memory, so the table is never larger than a
+ * full table of coset leaders. A syndrome not in the table is
+ * reported as uncorrectable instead of guessed at.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class CompactSyndromeTable
+{
+public:
+  /**
+   * Constructor specifying the code
+   * @param code the code to decode
+   */
+  CompactSyndromeTable( const CyclicCode &code );
+
+  /**
+   * Return the number of correctable nonzero syndromes
+   */
+  size_t get_size() const;
+
+  /**
+   * Return the bytes taken by the syndromes and errors
+   */
+  size_t get_memory_size() const;
+
+  /**
+   * compute the syndrome of a word
+   * @param word the word
+   * @return the syndrome, bit r from row r of the parity check matrix
+   */
+  uint get_syndrome( uint word ) const;
+
+  /**
+   * find the correctable error with a syndrome
+   * @param syndrome the syndrome
+   * @param error set to the error if there is one
+   * @return whether the syndrome is of an error of weight at most t
+   */
+  bool find_error( uint syndrome, uint &error ) const;
+
+  /**
+   * decode the received word
+   * @param received_word the word to be decoded
+   * @param decoded_word set to the code word within distance t
+   * @return false if no code word is within distance t, leaving
+   * decoded_word the received word
+   */
+  bool decode_word( uint received_word, uint &decoded_word ) const;
+
+private:
+
+  /**
+   * Return the bytes of the narrowest entry holding a number of bits
+   */
+  static uint get_entry_bytes( uint bits );
+
+  /**
+   * read an entry of a table
+   * @param entries the table
+   * @param entry_bytes the bytes of each entry
+   * @param index the entry
+   */
+  static uint load_entry( const vector< uint8_t > &entries,
+                          uint entry_bytes, size_t index );
+
+  /**
+   * write an entry of a table
+   * @param entries the table
+   * @param entry_bytes the bytes of each entry
+   * @param index the entry
+   * @param value the value, fitting in entry_bytes
+   */
+  static void store_entry( vector< uint8_t > &entries, uint entry_bytes,
+                           size_t index, uint value );
+
+  /**
+   * place the sorted entries in Eytzinger order by an in order walk
+   * of the implicit tree
+   * @param sorted the entries sorted by syndrome
+   * @param next the next sorted entry to place
+   * @param node the node of the tree, the root being 1
+   */
+  void place( const vector< pair< uint, uint > > &sorted, size_t &next,
+              size_t node );
+
+  /**
+   * find the node of the Eytzinger tree holding a syndrome
+   * @param syndrome the syndrome
+   * @return the node, or 0 if the syndrome is not in the tree
+   */
+  template< typename Key >
+  size_t find_node( uint syndrome ) const;
+
+  vector< uint > parity_check;
+  vector< uint8_t > syndromes;
+  vector< uint8_t > errors;
+  size_t num_correctable;
+  size_t num_entries;
+  uint syndrome_bytes;
+  uint error_bytes;
+  uint correctable_weight;
+  bool direct;
+};
+
+CompactSyndromeTable::CompactSyndromeTable( const CyclicCode &code )
+: parity_check( code.get_parity_check() ),
+  correctable_weight( ( code.get_min_distance() - 1 ) / 2 )
+{
+  uint code_length = code.get_code_length();
+  uint redundancy = parity_check.size();
+  syndrome_bytes = get_entry_bytes( redundancy );
+  error_bytes = get_entry_bytes( code_length );
+
+  //every error of weight 1 to t, walked by Gosper's method; for a
+  //code of distance d their syndromes are all distinct
+  vector< pair< uint, uint > > sorted;
+  uint64_t word_limit = uint64_t( 1 ) << code_length;
+  for( uint weight = 1; weight <= correctable_weight; weight++ )
+  {
+    for( uint64_t error = ( uint64_t( 1 ) << weight ) - 1;
+         error < word_limit; )
+    {
+      sorted.push_back( make_pair( get_syndrome( error ), uint( error ) ) );
+      uint64_t lowest = error & -error;
+      uint64_t ripple = error + lowest;
+      error = ( ( ( ripple ^ error ) >> 2 ) / lowest ) | ripple;
+    }
+  }
+  num_correctable = sorted.size();
+
+  //index the errors by syndrome when that is no larger than the
+  //tree; an empty entry, error 0, marks an uncorrectable syndrome
+  uint64_t direct_bytes = ( uint64_t( 1 ) << redundancy ) * error_bytes;
+  uint64_t tree_bytes =
+    uint64_t( sorted.size() + 1 ) * ( syndrome_bytes + error_bytes );
+  direct = direct_bytes <= tree_bytes;
+  if( direct )
+  {
+    num_entries = size_t( 1 ) << redundancy;
+    errors.assign( num_entries * error_bytes, 0 );
+    for( pair< uint, uint > entry : sorted )
+    {
+      store_entry( errors, error_bytes, entry.first, entry.second );
+    }
+    return;
+  }
+
+  //slot 0 is unused so the children of node i are 2i and 2i + 1
+  sort( sorted.begin(), sorted.end() );
+  num_entries = sorted.size() + 1;
+  syndromes.assign( num_entries * syndrome_bytes, 0 );
+  errors.assign( num_entries * error_bytes, 0 );
+  size_t next = 0;
+  place( sorted, next, 1 );
+}
+
+size_t CompactSyndromeTable::get_size() const
+{
+  return num_correctable;
+}
+
+size_t CompactSyndromeTable::get_memory_size() const
+{
+  return syndromes.size() + errors.size();
+}
+
+uint CompactSyndromeTable::get_syndrome( uint word ) const
+{
+  uint syndrome = 0;
+  for( uint row = 0; row < parity_check.size(); row++ )
+  {
+    syndrome |= uint( __builtin_parity( word & parity_check[ row ] ) )
+      << row;
+  }
+  return syndrome;
+}
+
+bool CompactSyndromeTable::find_error( uint syndrome, uint &error ) const
+{
+  size_t node = 0;
+  if( direct )
+  {
+    node = syndrome < num_entries ? syndrome : 0;
+  }
+  else if( syndrome_bytes == 1 )
+  {
+    node = find_node< uint8_t >( syndrome );
+  }
+  else if( syndrome_bytes == 2 )
+  {
+    node = find_node< uint16_t >( syndrome );
+  }
+  else
+  {
+    node = find_node< uint32_t >( syndrome );
+  }
+
+  //node 0 is the unused slot of the tree, or the zero syndrome
+  if( node == 0 )
+  {
+    return false;
+  }
+  uint found_error = load_entry( errors, error_bytes, node );
+  if( found_error == 0 )
+  {
+    return false;
+  }
+  error = found_error;
+  return true;
+}
+
+bool CompactSyndromeTable::decode_word( uint received_word,
+                                        uint &decoded_word ) const
+{
+  decoded_word = received_word;
+  uint syndrome = get_syndrome( received_word );
+  if( syndrome == 0 )
+  {
+    return true;
+  }
+  uint error;
+  if( !find_error( syndrome, error ) )
+  {
+    return false;
+  }
+  decoded_word = received_word ^ error;
+  return true;
+}
+
+uint CompactSyndromeTable::get_entry_bytes( uint bits )
+{
+  return bits <= 8 ? 1 : bits <= 16 ? 2 : 4;
+}
+
+uint CompactSyndromeTable::load_entry( const vector< uint8_t > &entries,
+                                       uint entry_bytes, size_t index )
+{
+  const uint8_t *entry = entries.data() + index * entry_bytes;
+  if( entry_bytes == 1 )
+  {
+    return *entry;
+  }
+  if( entry_bytes == 2 )
+  {
+    uint16_t value;
+    memcpy( &value, entry, sizeof( value ) );
+    return value;
+  }
+  uint32_t value;
+  memcpy( &value, entry, sizeof( value ) );
+  return value;
+}
+
+void CompactSyndromeTable::store_entry( vector< uint8_t > &entries,
+                                        uint entry_bytes, size_t index,
+                                        uint value )
+{
+  uint8_t *entry = entries.data() + index * entry_bytes;
+  if( entry_bytes == 1 )
+  {
+    *entry = static_cast< uint8_t >( value );
+  }
+  else if( entry_bytes == 2 )
+  {
+    uint16_t narrow_value = static_cast< uint16_t >( value );
+    memcpy( entry, &narrow_value, sizeof( narrow_value ) );
+  }
+  else
+  {
+    uint32_t narrow_value = value;
+    memcpy( entry, &narrow_value, sizeof( narrow_value ) );
+  }
+}
+
+void CompactSyndromeTable::place(
+  const vector< pair< uint, uint > > &sorted, size_t &next, size_t node )
+{
+  if( node < num_entries )
+  {
+    place( sorted, next, 2 * node );
+    store_entry( syndromes, syndrome_bytes, node, sorted[ next ].first );
+    store_entry( errors, error_bytes, node, sorted[ next ].second );
+    next++;
+    place( sorted, next, 2 * node + 1 );
+  }
+}
+
+template< typename Key >
+size_t CompactSyndromeTable::find_node( uint syndrome ) const
+{
+  //descend to the leaf past the least syndrome not below the one
+  //sought, prefetching the level whose nodes share the cache line
+  //of the descendants of this one
+  const size_t KEYS_PER_LINE = 64 / sizeof( Key );
+  const Key *keys = reinterpret_cast< const Key * >( syndromes.data() );
+  size_t node = 1;
+  while( node < num_entries )
+  {
+    __builtin_prefetch( keys + KEYS_PER_LINE * node );
+    node = 2 * node + ( keys[ node ] < syndrome );
+  }
+
+  //strip the right turns taken after the last left turn to reach
+  //the node that was the answer; zero means every node was below
+  node >>= __builtin_ffsll( ~static_cast< unsigned long long >( node ) );
+  if( node == 0 || keys[ node ] != syndrome )
+  {
+    return 0;
+  }
+  return node;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+
+/**
+ * The instruction set extensions the bit kernels can use, detected
+ * once per process. Kernels are compiled for each extension with
+ * target attributes and chosen from these flags at run time, so one
+ * binary runs on every x86-64 host, and every kernel has a portable
+ * version giving identical results. Setting the environment variable
+ * CYCLIC_CODES_PORTABLE clears every flag, to compare a host's
+ * results against the portable kernels.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+struct CpuFeatures
+{
+  bool popcnt;
+  bool avx2;
+  bool avx512f;
+  bool avx512vpopcntdq;
+
+  CpuFeatures()
+  : popcnt( false ), avx2( false ), avx512f( false ),
+    avx512vpopcntdq( false )
+  {
+    if( getenv( "CYCLIC_CODES_PORTABLE" ) != nullptr )
+    {
+      return;
+    }
+    __builtin_cpu_init();
+    popcnt = __builtin_cpu_supports( "popcnt" );
+    avx2 = __builtin_cpu_supports( "avx2" );
+    avx512f = __builtin_cpu_supports( "avx512f" );
+    avx512vpopcntdq = avx512f &&
+      __builtin_cpu_supports( "avx512vpopcntdq" );
+  }
+
+  /**
+   * print the extensions found
+   */
+  void print_features() const
+  {
+    cout << "cpu features:"
+         << ( popcnt ? " popcnt" : "" ) << ( avx2 ? " avx2" : "" )
+         << ( avx512f ? " avx512f" : "" )
+         << ( avx512vpopcntdq ? " avx512vpopcntdq" : "" ) << endl;
+  }
+};
+
+/**
+ * Return the features of this processor, detecting them on the first
+ * call
+ */
+const CpuFeatures &get_cpu_features()
+{
+  static const CpuFeatures features;
+  return features;
+}
+
+#endif
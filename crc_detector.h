@@ -0,0 +1,198 @@
+#ifndef CRC_DETECTOR_H
+#define CRC_DETECTOR_H
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * An error detector that treats a generator polynomial g(x) of degree
+ * r <= 31 as a CRC polynomial. The check value of a byte buffer is
+ * M(x) x^r mod g(x), where M(x) has the first byte in its highest
+ * places, most significant bit first, so the buffer followed by its
+ * check value is a multiple of g(x). Eight bytes are folded into the
+ * remainder at a time with eight 256 entry tables, table k holding
+ * the remainder of a byte followed by k zero bytes.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class CrcDetector
+{
+public:
+  /**
+   * Constructor specifying the generator polynomial
+   * @param generator_polynomial g(x), bit i the coefficient of x^i
+   */
+  CrcDetector( uint generator_polynomial );
+
+  /**
+   * Return the degree r of the generator polynomial
+   */
+  uint get_degree() const;
+
+  /**
+   * compute the check value of a byte buffer
+   * @param bytes the buffer
+   * @param length the number of bytes
+   * @param crc the check value of the bytes before these, to
+   * continue a running check
+   * @return the r bit check value
+   */
+  uint compute_crc( const uint8_t *bytes, size_t length,
+                    uint crc = 0 ) const;
+
+  /**
+   * determine if a buffer agrees with its check value
+   * @param bytes the buffer
+   * @param length the number of bytes
+   * @param expected_crc the check value sent with the buffer
+   * @return whether no error was detected
+   */
+  bool is_intact( const uint8_t *bytes, size_t length,
+                  uint expected_crc ) const;
+
+  /**
+   * count the code words of each weight in the code of length n
+   * generated by g(x), by running through the messages in Gray code
+   * order so each code word is one shifted g(x) from the last
+   * @param code_length n, at most 32
+   * @return the number of code words of weight w, for 0 <= w <= n
+   */
+  vector< uint64_t > get_weight_distribution( uint code_length ) const;
+
+  /**
+   * determine the probability that a binary symmetric channel turns
+   * a code word of length n into another code word, the sum of
+   * A_w p^w ( 1 - p )^( n - w ) over the nonzero weights
+   * @param code_length n, at most 32
+   * @param bit_error_rate the crossover probability p
+   * @return the probability of an undetected error
+   */
+  double get_undetected_error_probability( uint code_length,
+                                           double bit_error_rate ) const;
+
+private:
+  uint generator_polynomial;
+  uint degree;
+  uint aligned_polynomial;
+  vector< uint > tables;
+};
+
+CrcDetector::CrcDetector( uint param_generator_polynomial )
+: generator_polynomial( param_generator_polynomial ), degree( 0 )
+{
+  if( generator_polynomial < 2 || generator_polynomial > INT_MAX )
+  {
+    cout << "the generator must have degree 1 to 31." << endl;
+    generator_polynomial = 3;
+  }
+  degree = 31 - __builtin_clz( generator_polynomial );
+
+  //the remainder register is kept in the high r bits of a uint, so
+  //the leading coefficient is always bit 31
+  aligned_polynomial = ( generator_polynomial ^ ( 1u << degree ) )
+    << ( 32 - degree );
+  tables.assign( 8 * 256, 0 );
+  for( uint byte = 0; byte < 256; byte++ )
+  {
+    uint remainder = byte << 24;
+    for( uint bit = 0; bit < 8; bit++ )
+    {
+      remainder = ( remainder & 0x80000000 ) != 0 ?
+        ( remainder << 1 ) ^ aligned_polynomial : remainder << 1;
+    }
+    tables.at( byte ) = remainder;
+  }
+  for( uint k = 1; k < 8; k++ )
+  {
+    for( uint byte = 0; byte < 256; byte++ )
+    {
+      uint previous = tables.at( ( k - 1 ) * 256 + byte );
+      tables.at( k * 256 + byte ) =
+        ( previous << 8 ) ^ tables.at( previous >> 24 );
+    }
+  }
+}
+
+uint CrcDetector::get_degree() const
+{
+  return degree;
+}
+
+uint CrcDetector::compute_crc( const uint8_t *bytes, size_t length,
+                               uint crc ) const
+{
+  const uint *table = tables.data();
+  uint remainder = crc << ( 32 - degree );
+
+  //slicing by 8: the first four bytes meet the remainder, and all
+  //eight are looked up by how far they are from the end
+  while( length >= 8 )
+  {
+    uint first = remainder ^ ( ( uint( bytes[ 0 ] ) << 24 ) |
+      ( uint( bytes[ 1 ] ) << 16 ) | ( uint( bytes[ 2 ] ) << 8 ) | bytes[ 3 ] );
+    remainder = table[ 7 * 256 + ( first >> 24 ) ] ^
+      table[ 6 * 256 + ( ( first >> 16 ) & 0xFF ) ] ^
+      table[ 5 * 256 + ( ( first >> 8 ) & 0xFF ) ] ^
+      table[ 4 * 256 + ( first & 0xFF ) ] ^
+      table[ 3 * 256 + bytes[ 4 ] ] ^ table[ 2 * 256 + bytes[ 5 ] ] ^
+      table[ 256 + bytes[ 6 ] ] ^ table[ bytes[ 7 ] ];
+    bytes += 8;
+    length -= 8;
+  }
+  while( length > 0 )
+  {
+    remainder = ( remainder << 8 ) ^ table[ ( remainder >> 24 ) ^ *bytes ];
+    bytes++;
+    length--;
+  }
+  return remainder >> ( 32 - degree );
+}
+
+bool CrcDetector::is_intact( const uint8_t *bytes, size_t length,
+                             uint expected_crc ) const
+{
+  return compute_crc( bytes, length ) == expected_crc;
+}
+
+vector< uint64_t > CrcDetector::get_weight_distribution(
+  uint code_length ) const
+{
+  vector< uint64_t > weights( code_length + 1, 0 );
+  if( code_length <= degree || code_length > 32 )
+  {
+    cout << "the code length must be between r + 1 and 32." << endl;
+    return weights;
+  }
+
+  //flipping message bit i adds x^i g(x) to the code word
+  uint dimension = code_length - degree;
+  uint code_word = 0;
+  weights.at( 0 ) = 1;
+  for( uint64_t step = 1; step < ( uint64_t( 1 ) << dimension ); step++ )
+  {
+    code_word ^= generator_polynomial << __builtin_ctzll( step );
+    weights.at( __builtin_popcount( code_word ) )++;
+  }
+  return weights;
+}
+
+double CrcDetector::get_undetected_error_probability(
+  uint code_length, double bit_error_rate ) const
+{
+  vector< uint64_t > weights = get_weight_distribution( code_length );
+  double probability = 0;
+  for( uint weight = 1; weight <= code_length; weight++ )
+  {
+    probability += weights.at( weight ) * pow( bit_error_rate, weight ) *
+      pow( 1 - bit_error_rate, code_length - weight );
+  }
+  return probability;
+}
+
+#endif
@@ -16,6 +16,9 @@
 #include "noisy_channel.h"
 #include "mapping.h"
 #include "cyclic_codes.h"
+#include "hadamard_decoder.h"
+#include "crc_detector.h"
+#include "alloc_tracker.h"
 
 using namespace std;
 
@@ -566,6 +569,7 @@ int main()
   //determine the rref in order to find g_permuted and
   //determine the parity check matrix
 
+  begin_allocation_phase( "construction" );
   vector< uint > g_matrix =
     find_rref( code_matrix, code_length );
   vector< uint > permutation = find_permutation(
@@ -597,6 +601,7 @@ int main()
   /* testing */
   
   //create cyclic code object
+  begin_allocation_phase( "code construction" );
   CyclicCode this_code = CyclicCode( code_matrix, parity_permuted,
                                      code_length );
 
@@ -605,10 +610,12 @@ int main()
   this_code.print_parity_check();
   //this_code.print_words();
 
+  begin_allocation_phase( "decode all words" );
   for( uint i = 0; i < find_power( 2, code_length ); i++ )
   {
     this_code.decode_word( i );
   }
+  begin_allocation_phase( "crc detector" );
  
   
   cout << "degree of generator: " << degree_of_generator << endl;
@@ -620,7 +627,15 @@ int main()
   cout << "the (I_n-k|A) form of the parity check matrix: " << endl;
   print_bitwise( parity_permuted, code_length );
 
+  //how often g(x) used only as a CRC misses errors
+  CrcDetector crc_detector = CrcDetector( generator_polynomial );
+  cout << "undetected error probability at p = 0.001: "
+       << crc_detector.get_undetected_error_probability( code_length, 0.001 )
+       << endl;
+  cout << endl;
+
   //determine the map between words and encoded words
+    begin_allocation_phase( "mapping" );
     vector< uint > encoded_words;
     uint num_words = 32;
       //find_power( 2, this_code.get_generator().size() );
@@ -672,6 +687,7 @@ int main()
 
 
     //introduce random noise into message
+    begin_allocation_phase( "noise" );
     uint num_errors = 2;
     random_noise( encoded_message,
                   this_code.get_code_length(), num_errors );
@@ -700,13 +716,26 @@ int main()
     cout << endl;
 
     
-    //extract message from received message
+    //extract message from received message, using the transform
+    //decoder when the dual of the code is a Hamming code
+    begin_allocation_phase( "decoder construction" );
+    HadamardDecoder hadamard_decoder = HadamardDecoder( this_code );
     vector< uint > decoded_message;
+    decoded_message.reserve( encoded_message.size() );
+    begin_allocation_phase( "decode" );
     for( uint word : encoded_message )
     {
-      decoded_message.push_back( this_code.decode_word( word ) );
+      if( hadamard_decoder.is_applicable() )
+      {
+        decoded_message.push_back( hadamard_decoder.decode_word( word ) );
+      }
+      else
+      {
+        decoded_message.push_back( this_code.decode_word( word ) );
+      }
     }
 
+    begin_allocation_phase( "output" );
     vector< char > char_d_message = map.convert_to_letters( decoded_message );
     
     cout << "the decoded received message: " << endl;
@@ -719,6 +748,7 @@ int main()
 
     
     //determine accuracy
+    begin_allocation_phase( "accuracy" );
     float letters_identical = 0;
     for( uint i = 0; i < og_message.size(); i++ )
     {
@@ -730,6 +760,18 @@ int main()
     cout << "percent identity: " <<
       ( letters_identical / og_message.size() ) * 100 << endl;
 
+    //check the decoded message against the check value of the original
+    bool intact = crc_detector.is_intact(
+      reinterpret_cast< const uint8_t * >( char_d_message.data() ),
+      char_d_message.size(),
+      crc_detector.compute_crc(
+        reinterpret_cast< const uint8_t * >( og_message.data() ),
+        og_message.size() ) );
+    cout << "CRC check of decoded message: "
+         << ( intact ? "passed" : "failed" ) << endl;
+
+    print_allocation_report();
+
     //-------------------------------------------------------
   
   /* end testing */
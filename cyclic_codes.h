@@ -5,6 +5,7 @@
 #include <iostream>
 #include <vector>
 #include <climits>
+#include "bit_kernels.h"
 
 using namespace std;
 
@@ -32,11 +33,22 @@ public:
    */
   vector< uint > get_generator() const;
 
+  /**
+   * Return the parity check matrix
+   * @return the parity check matrix
+   */
+  vector< uint > get_parity_check() const;
+
   /**
    * Return the code length
    */
   uint get_code_length() const;
 
+  /**
+   * Return the minimum distance of the code
+   */
+  uint get_min_distance() const;
+
   /**
    * Return the code words
    */
@@ -78,6 +90,38 @@ public:
    */
   uint encode_word( uint word ) const;
 
+  /**
+   * recover the word that was encoded from a code word, by dividing
+   * by the generator polynomial
+   * @param code_word the code word
+   * @return the word that encodes to it
+   */
+  uint extract_message( uint code_word ) const;
+
+  /**
+   * decode a batch of received words
+   * @param received_words the words to be decoded
+   * @return the decoded words
+   */
+  vector< uint > decode_batch( const vector< uint > &received_words ) const;
+
+  /**
+   * decode using nearest neighbor decoding
+   * @param received_word the word to be decoded
+   * @return the nearest code word, the first in the list of code
+   * words if there are several
+   */
+  uint nearest_neighbor( uint received_word ) const;
+
+  /**
+   * decode a batch of received words by nearest neighbor decoding,
+   * comparing the whole batch against a tile of code words at a time
+   * @param received_words the words to be decoded
+   * @return the nearest code word to each
+   */
+  vector< uint > nearest_neighbors(
+    const vector< uint > &received_words ) const;
+
 private:
 
   /**
@@ -99,7 +143,16 @@ private:
    * @param matrix the matrix to be printed
    * @param code_length the length of the code
    */
-  void print_matrix( vector< uint > matrix, uint code_length ) const;
+  void print_matrix( const vector< uint > &matrix, uint code_length ) const;
+
+  /**
+   * print the rows of a matrix held in an array
+   * @param matrix the rows of the matrix
+   * @param num_rows the number of rows
+   * @param code_length the length of the code
+   */
+  void print_matrix( const uint *matrix, uint num_rows,
+                     uint code_length ) const;
 
   /**
    * determine the transpose of a matrix
@@ -116,9 +169,19 @@ private:
    * @return the result
    */
   uint find_power( uint base, uint exponent ) const;
+
+  /**
+   * rotate a word cyclically, so x^i w(x) mod x^n - 1
+   * @param word the word
+   * @param amount the places to rotate by, less than the word length
+   * @param word_length the length of the word
+   * @return the rotated word
+   */
+  uint rotate_word( uint word, uint amount, uint word_length ) const;
   
   vector< uint > generator;
   vector< uint > parity_check;
+  vector< uint > parity_transpose;
   vector< uint > code_words;
   uint code_length;
   uint min_distance;
@@ -130,6 +193,10 @@ CyclicCode::CyclicCode( vector< uint > param_generator,
 : generator( param_generator ), parity_check( param_parity_check ),
   code_length( param_code_length )
 {
+  //the columns of the parity check matrix, so decoding sums the
+  //columns for the bits of a word without building them again
+  parity_transpose = get_transpose( parity_check, code_length );
+
   //determine code words
   for( uint i = 0; i < find_power( 2, code_length ); i++ )
   {
@@ -139,17 +206,16 @@ CyclicCode::CyclicCode( vector< uint > param_generator,
     }
   }
 
-  //determine minimum distance of the code
+  //determine minimum distance of the code from the weights of all
+  //the code words at once
+  vector< uint8_t > weights( code_words.size() );
+  word_distances( 0, code_words.data(), code_words.size(), weights.data() );
   uint distance = UINT_MAX;
-  for( uint word : code_words )
+  for( uint i = 0; i < code_words.size(); i++ )
   {
-    if( word > 0 )
+    if( code_words.at( i ) > 0 && weights.at( i ) < distance )
     {
-      uint word_weight = hamming_distance( 0, word );
-      if( word_weight < distance )
-      {
-        distance = word_weight;
-      }
+      distance = weights.at( i );
     }
   }
   min_distance = distance;
@@ -166,28 +232,36 @@ vector< uint > CyclicCode::get_generator() const
   return generator;
 }
 
+vector< uint > CyclicCode::get_parity_check() const
+{
+  return parity_check;
+}
+
 uint CyclicCode::get_code_length() const
 {
   return code_length;
 }
 
-void CyclicCode::print_matrix( vector< uint > matrix,
+uint CyclicCode::get_min_distance() const
+{
+  return min_distance;
+}
+
+void CyclicCode::print_matrix( const vector< uint > &matrix,
+                               uint code_length ) const
+{
+  print_matrix( matrix.data(), matrix.size(), code_length );
+}
+
+void CyclicCode::print_matrix( const uint *matrix, uint num_rows,
                                uint code_length ) const
 {
   //find and print the bitwise representation of matrix
-  for( uint i = 0; i < matrix.size(); i++ )
+  for( uint i = 0; i < num_rows; i++ )
   {
-    uint this_code_word = matrix.at( i );
-    vector< uint > code_word_bitwise;
-    for( uint j = 0; j < code_length; j++ )
-    {
-      uint this_bit = ( this_code_word >> j ) & 1;
-      code_word_bitwise.push_back( this_bit );
-    }
-
     for( uint j = code_length - 1; j < UINT_MAX; j-- )
     {
-      cout << code_word_bitwise.at( j );
+      cout << ( ( matrix[ i ] >> j ) & 1 );
     }
     cout << endl;
   }
@@ -197,18 +271,11 @@ void CyclicCode::print_matrix( vector< uint > matrix,
 void CyclicCode::print_word_bitwise( uint word ) const
 {
   //find and print bitwise representation of codeword
-  vector< uint > code_word_bitwise;
-  for( uint j = 0; j < code_length; j++ )
+  for( uint i = code_length - 1; i < UINT_MAX; i-- )
   {
-    uint this_bit = ( word >> j ) & 1;
-    code_word_bitwise.push_back( this_bit );
+    cout << ( ( word >> i ) & 1 );
   }
-
-  for( uint i = code_length - 1; i < UINT_MAX; i-- )
-    {
-      cout << code_word_bitwise.at( i );
-    }
-    cout << endl;
+  cout << endl;
 }
 
 void CyclicCode::print_generator() const
@@ -237,38 +304,17 @@ void CyclicCode::print_words() const
 
 bool CyclicCode::is_code_word( uint word ) const
 {
-  //determine the product between the parity
-  //check matrix transpose and the word
-  vector< uint > vector_product;
-  for( uint col = 0; col < parity_check.size(); col++ )
+  //the word is in the code when its dot product with every row of
+  //the parity check matrix is zero, and each dot product is the
+  //parity of the bits the word shares with the row
+  for( uint row : parity_check )
   {
-    //determine the dot product between each column of the
-    //parity check matrix transpose and the word
-    uint dot_product = 0;
-    uint this_term = 0;
-    for( uint row = 0; row < code_length; row++ )
+    if( __builtin_parity( word & row ) != 0 )
     {
-      uint word_coordinate = ( word >> row ) & 1;
-      uint basis_vector_coordinate = ( parity_check.at( col )
-                                       >> row ) & 1;
-      
-      this_term = word_coordinate & basis_vector_coordinate;
-      dot_product = dot_product ^ this_term;
+      return false;
     }
-    vector_product.push_back( dot_product );
   }
-
-  //determine if the product is the zero vector
-  bool is_word = true;
-  for( uint this_word = 0; this_word < vector_product.size();
-       this_word++ )
-  {
-    if( vector_product.at( this_word ) != 0 )
-    {
-      is_word = false;
-    }
-  }
-  return is_word;
+  return true;
 }
 
 vector< uint > CyclicCode::get_transpose( vector< uint > matrix,
@@ -325,6 +371,19 @@ uint CyclicCode::find_power( uint base, uint exponent ) const
   }
 }
 
+uint CyclicCode::rotate_word( uint word, uint amount,
+                              uint word_length ) const
+{
+  if( amount == 0 )
+  {
+    return word;
+  }
+  uint word_mask = word_length < 32 ? ( 1u << word_length ) - 1 : UINT_MAX;
+  word &= word_mask;
+  return ( ( word << amount ) | ( word >> ( word_length - amount ) ) )
+    & word_mask;
+}
+
 uint CyclicCode::encode_word( uint word ) const
 {
   //determine the product of the word with the
@@ -346,59 +405,83 @@ uint CyclicCode::encode_word( uint word ) const
   return encoded_word;
 }
 
-uint CyclicCode::decode_word( uint received_word ) const
+uint CyclicCode::extract_message( uint code_word ) const
 {
-  //first compute x^i * w(x) for 0 < i < n
-
-  //determine the locations of the bits in the received word
-  vector< uint > bit_place_values;
-  for( uint i = 0; i < code_length; i++ )
+  //the rows of the generator matrix are x^i g(x), the last being
+  //g(x) itself, so the code word is u(x) g(x)
+  uint generator_polynomial = generator.at( generator.size() - 1 );
+  uint degree = 31 - __builtin_clz( generator_polynomial );
+  uint message = 0;
+  for( uint place_value = code_length - 1;
+       place_value != UINT_MAX && place_value >= degree; place_value-- )
   {
-    if( ( ( received_word >> i ) & 1 ) == 1 )
+    if( ( ( code_word >> place_value ) & 1 ) == 1 )
     {
-      bit_place_values.push_back( i );
+      message |= 1u << ( place_value - degree );
+      code_word ^= generator_polynomial << ( place_value - degree );
     }
   }
+  return message;
+}
 
-  //determine new place values for a cyclic shift
-  //of the received word
-  vector< uint > received_cyclic_shifts = { received_word };
-  for( uint i = 1; i < code_length; i++ )
+vector< uint > CyclicCode::decode_batch(
+  const vector< uint > &received_words ) const
+{
+  vector< uint > decoded_words;
+  decoded_words.reserve( received_words.size() );
+  for( uint word : received_words )
   {
-    for( uint j = 0; j < bit_place_values.size(); j++ )
-    {
-      bit_place_values.at( j ) =
-        ( bit_place_values.at( j ) + 1 ) % ( code_length );
-    }
+    decoded_words.push_back( decode_word( word ) );
+  }
+  return decoded_words;
+}
 
-    //create the corresponding word and add it to the list
-    uint cyclic_shift = 0;
-    for( uint place_value : bit_place_values )
-    {
-      cyclic_shift += find_power( 2, place_value );
-    }
-    
-    received_cyclic_shifts.push_back( cyclic_shift );
+uint CyclicCode::nearest_neighbor( uint received_word ) const
+{
+  //the word minus the nearest code word is the least weight word of
+  //its coset, so scan the code words directly without forming the
+  //coset
+  uint distance;
+  return code_words.at( nearest_word( received_word, code_words.data(),
+                                      code_words.size(), distance ) );
+}
+
+vector< uint > CyclicCode::nearest_neighbors(
+  const vector< uint > &received_words ) const
+{
+  vector< size_t > nearest( received_words.size() );
+  nearest_words( received_words.data(), received_words.size(),
+                 code_words.data(), code_words.size(), nearest.data() );
+  vector< uint > decoded_words;
+  decoded_words.reserve( received_words.size() );
+  for( size_t index : nearest )
+  {
+    decoded_words.push_back( code_words.at( index ) );
   }
+  return decoded_words;
+}
 
-  //next compute s_i(x) for each cyclic shift
-  vector< uint > syndromes;
-  vector< uint > parity_transpose = get_transpose( parity_check,
-                                                   code_length );
-  for( uint i = 0; i < received_cyclic_shifts.size(); i++ )
+uint CyclicCode::decode_word( uint received_word ) const
+{
+  //first compute x^i * w(x) for 0 < i < n, and s_i(x) for each
+  //cyclic shift by summing the parity check columns of its bits;
+  //both lists fit on the stack, so decoding never allocates
+  uint received_cyclic_shifts[ 32 ];
+  uint syndromes[ 32 ];
+  uint word_mask = code_length < 32 ? ( 1u << code_length ) - 1 : UINT_MAX;
+  for( uint i = 0; i < code_length; i++ )
   {
+    received_cyclic_shifts[ i ] =
+      rotate_word( received_word, i, code_length );
+
     uint syndrome = 0;
-    for( uint place_value = 0; place_value < parity_transpose.size();
-         place_value++ )
+    for( uint bits = received_cyclic_shifts[ i ] & word_mask; bits != 0;
+         bits &= bits - 1 )
     {
-      if( ( ( received_cyclic_shifts.at( i )
-              >> place_value ) & 1 ) == 1 )
-      {
-        syndrome ^= parity_transpose.at( parity_transpose.size()
-                                         - 1 - place_value );
-      }
+      uint place_value = __builtin_ctz( bits );
+      syndrome ^= parity_transpose[ code_length - 1 - place_value ];
     }
-    syndromes.push_back( syndrome );
+    syndromes[ i ] = syndrome;
   }
 
 
@@ -407,9 +490,9 @@ uint CyclicCode::decode_word( uint received_word ) const
   /*
   cout << "min distance : " << min_distance << endl;
   cout << "a word shifted cyclically: " << endl;
-  for( uint word : received_cyclic_shifts )
+  for( uint i = 0; i < code_length; i++ )
   {
-    print_word_bitwise( word );
+    print_word_bitwise( received_cyclic_shifts[ i ] );
   }
   cout << endl;
   
@@ -417,7 +500,7 @@ uint CyclicCode::decode_word( uint received_word ) const
   print_matrix( parity_transpose, parity_check.size() );
 
   cout << "the syndromes: " << endl;
-  print_matrix( syndromes, parity_check.size() );
+  print_matrix( syndromes, code_length, parity_check.size() );
   */  
   //END TESTS
 
@@ -428,9 +511,9 @@ uint CyclicCode::decode_word( uint received_word ) const
   uint which_syndrome = 0;
   uint light_syndrome = 0;
   uint bound = ( min_distance - 1 ) / 2;
-  while( !found_syndrome && ( which_syndrome < syndromes.size() ) )
+  while( !found_syndrome && ( which_syndrome < code_length ) )
   {
-    if( hamming_distance( 0, syndromes.at( which_syndrome ) ) <=
+    if( hamming_distance( 0, syndromes[ which_syndrome ] ) <=
         bound )
     {
       found_syndrome = true;
@@ -443,99 +526,38 @@ uint CyclicCode::decode_word( uint received_word ) const
 
   //if no syndrome meets requirements, use old fashioned
   //nearest neighbor decoding
-  uint decoded_word = 0;
   if( !found_syndrome )
   {
-     //determine the coset for the received word
-    vector< uint > received_word_coset;
-    for( uint word = 0; word < code_words.size(); word++ )
-    {
-      uint coset_word = received_word ^ code_words.at( word );
-      received_word_coset.push_back( coset_word );
-    }
-
-    //optional print cosets
-    /*
-      cout << "received word: " << received_word << endl;
-      cout << "corresponding coset: ";
-      for( uint i = 0; i < received_word_coset.size(); i++ )
-      {
-      cout << received_word_coset.at( i ) << " ";
-      }
-      cout << endl;
-      cout << endl;
-    */
-
-    //determine the least hamming weight in the coset
-    uint error_word = received_word_coset.at( 0 );
-    uint least_hw = UINT_MAX;
-    const uint ZERO_VECTOR = 0;
-    
-    for( uint i = 0; i < received_word_coset.size(); i++ )
-    {
-      uint this_hw = hamming_distance( ZERO_VECTOR,
-                                       received_word_coset.at( i ) );
-      if( this_hw < least_hw )
-      {
-        least_hw = this_hw;
-        error_word = received_word_coset.at( i );
-      }
-    }
-    //return the received word minus the error word
-    decoded_word = received_word ^ error_word;    
-    return decoded_word;
+    return nearest_neighbor( received_word );
   }
 
   //otherwise continue syndrome decoding
-  light_syndrome = syndromes.at( which_syndrome );
+  light_syndrome = syndromes[ which_syndrome ];
 
   //shift syndrome to align with proper degree term in polynomial
   light_syndrome =
     light_syndrome << ( code_length - parity_check.size() );
 
   //shift light_syndrome by the proper degree and subtract
-
-  //remember place values
   uint shift_amount = code_length - which_syndrome;
-  vector< uint > syndrome_bit_place_values;
-  for( uint i = 0; i < code_length; i++ )
-  {
-    if( ( ( light_syndrome >> i ) & 1 ) == 1 )
-    {
-      syndrome_bit_place_values.push_back( i );
-    }
-  }
+  uint shifted_syndrome =
+    rotate_word( light_syndrome, shift_amount % code_length, code_length );
 
-  //shift place values
-  for( uint i = 0; i < syndrome_bit_place_values.size(); i++ )
-  {
-    syndrome_bit_place_values.at( i ) =
-      ( syndrome_bit_place_values.at( i )
-        + shift_amount ) % code_length;
-  }
-
-  //construct shifted syndrome
-  uint shifted_syndrome = 0;
-  for( uint place_value : syndrome_bit_place_values )
-  {
-    shifted_syndrome += find_power( 2, place_value );
-  }
-
-  decoded_word = received_word ^ shifted_syndrome;
+  uint decoded_word = received_word ^ shifted_syndrome;
 
   /* TESTING */
 
   if( !is_code_word( decoded_word ) )
   {
     cout << "a word shifted cyclically: " << endl;
-    for( uint word : received_cyclic_shifts )
+    for( uint i = 0; i < code_length; i++ )
     {
-      print_word_bitwise( word );
+      print_word_bitwise( received_cyclic_shifts[ i ] );
     }
     cout << endl;
   
     cout << "the corresponding syndromes: " << endl;
-    print_matrix( syndromes, parity_check.size() );
+    print_matrix( syndromes, code_length, parity_check.size() );
     cout << endl;
   
     cout << "min distance : " << min_distance << endl;
@@ -556,14 +578,8 @@ uint CyclicCode::decode_word( uint received_word ) const
 uint CyclicCode::hamming_distance( uint first_word,
                                    uint second_word ) const
 {
-  uint places_differ = first_word ^ second_word;
-  uint hamming_distance = 0;
-  for( uint place_value = 0; place_value < code_length;
-       place_value++ )
-  {
-    hamming_distance += ( ( places_differ >> place_value ) & 1 );
-  }
-  return hamming_distance;
+  uint word_mask = code_length < 32 ? ( 1u << code_length ) - 1 : UINT_MAX;
+  return word_weight( ( first_word ^ second_word ) & word_mask );
 }
 
 #endif
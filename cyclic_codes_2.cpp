@@ -16,6 +16,7 @@
 #include "noisy_channel.h"
 #include "mapping.h"
 #include "cyclic_codes_2.h"
+#include "alloc_tracker.h"
 
 using namespace std;
 
@@ -566,6 +567,7 @@ int main()
   //determine the rref in order to find g_permuted and
   //determine the parity check matrix
 
+  begin_allocation_phase( "construction" );
   vector< uint > g_matrix =
     find_rref( code_matrix, code_length );
   vector< uint > permutation = find_permutation(
@@ -597,6 +599,7 @@ int main()
   /* testing */
   
   //create cyclic code object
+  begin_allocation_phase( "code construction" );
   CyclicCode this_code = CyclicCode( code_matrix, parity_permuted,
                                      code_length );
 
@@ -616,6 +619,7 @@ int main()
   print_bitwise( parity_permuted, code_length );
 
   //determine the map between words and encoded words
+    begin_allocation_phase( "mapping" );
     vector< uint > encoded_words;
     uint num_words =
       find_power( 2, code_length );
@@ -683,6 +687,7 @@ int main()
 
     /* introduce burst 
        noise */
+    begin_allocation_phase( "noise" );
     uint burst_size = 3;
     burst_noise( encoded_message, code_length, burst_size );
     cout << "length of burst errors: " << burst_size << endl;
@@ -703,11 +708,14 @@ int main()
     
     //extract message from received message
     vector< uint > decoded_message;
+    decoded_message.reserve( encoded_message.size() );
+    begin_allocation_phase( "decode" );
     for( uint word : encoded_message )
     {
       decoded_message.push_back( this_code.decode_word( word ) );
     }
 
+    begin_allocation_phase( "output" );
     vector< char > char_d_message = map.convert_to_letters( decoded_message );
     
     cout << "the decoded received message: " << endl;
@@ -720,6 +728,7 @@ int main()
 
     
     //determine accuracy
+    begin_allocation_phase( "accuracy" );
     float letters_identical = 0;
     for( uint i = 0; i < og_message.size(); i++ )
     {
@@ -731,6 +740,8 @@ int main()
     cout << "percent identity: " <<
       ( letters_identical / og_message.size() ) * 100 << endl;
 
+    print_allocation_report();
+
     //-------------------------------------------------------
   
   /* end testing */
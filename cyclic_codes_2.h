@@ -5,6 +5,7 @@
 #include <iostream>
 #include <vector>
 #include <climits>
+#include "bit_kernels.h"
 
 using namespace std;
 
@@ -32,11 +33,22 @@ public:
    */
   vector< uint > get_generator() const;
 
+  /**
+   * Return the parity check matrix
+   * @return the parity check matrix
+   */
+  vector< uint > get_parity_check() const;
+
   /**
    * Return the code length
    */
   uint get_code_length() const;
 
+  /**
+   * Return the minimum distance of the code
+   */
+  uint get_min_distance() const;
+
   /**
    * Return the code words
    */
@@ -78,6 +90,30 @@ public:
    */
   uint encode_word( uint word ) const;
 
+  /**
+   * recover the word that was encoded from a code word, by dividing
+   * by the generator polynomial
+   * @param code_word the code word
+   * @return the word that encodes to it
+   */
+  uint extract_message( uint code_word ) const;
+
+  /**
+   * decode a batch of received words
+   * @param received_words the words to be decoded
+   * @return the decoded words
+   */
+  vector< uint > decode_batch( const vector< uint > &received_words ) const;
+
+  /**
+   * decode a batch of received words by nearest neighbor decoding,
+   * comparing the whole batch against a tile of code words at a time
+   * @param received_words the words to be decoded
+   * @return the nearest code word to each
+   */
+  vector< uint > nearest_neighbors(
+    const vector< uint > &received_words ) const;
+
 private:
 
   /**
@@ -97,17 +133,18 @@ private:
   /**
    * computes syndromes for a received word
    * @param received_word
-   * @return a list of syndromes
+   * @param syndromes set to the code length syndromes
    */
-  vector< uint > get_syndromes( uint received_word ) const;
+  void get_syndromes( uint received_word, uint *syndromes ) const;
 
   /**
    * computes all cyclic shifts for a codeword
    * @param word the word to shift
-   * @return a list with all the shifted words
+   * @param word_length the length of the word
+   * @param cyclic_shifts set to the word_length shifted words
    */
-  vector< uint > get_cyclic_shifts( uint word,
-                                    uint word_length ) const;
+  void get_cyclic_shifts( uint word, uint word_length,
+                          uint *cyclic_shifts ) const;
 
   /**
    * determines the hamming distance between two words
@@ -128,7 +165,16 @@ private:
    * @param matrix the matrix to be printed
    * @param code_length the length of the code
    */
-  void print_matrix( vector< uint > matrix, uint code_length ) const;
+  void print_matrix( const vector< uint > &matrix, uint code_length ) const;
+
+  /**
+   * print the rows of a matrix held in an array
+   * @param matrix the rows of the matrix
+   * @param num_rows the number of rows
+   * @param code_length the length of the code
+   */
+  void print_matrix( const uint *matrix, uint num_rows,
+                     uint code_length ) const;
 
   /**
    * determine the transpose of a matrix
@@ -145,9 +191,19 @@ private:
    * @return the result
    */
   uint find_power( uint base, uint exponent ) const;
+
+  /**
+   * rotate a word cyclically, so x^i w(x) mod x^n - 1
+   * @param word the word
+   * @param amount the places to rotate by, less than the word length
+   * @param word_length the length of the word
+   * @return the rotated word
+   */
+  uint rotate_word( uint word, uint amount, uint word_length ) const;
   
   vector< uint > generator;
   vector< uint > parity_check;
+  vector< uint > parity_transpose;
   vector< uint > code_words;
   uint code_length;
   uint min_distance;
@@ -160,6 +216,10 @@ CyclicCode::CyclicCode( vector< uint > param_generator,
 : generator( param_generator ), parity_check( param_parity_check ),
   code_length( param_code_length )
 {
+  //the columns of the parity check matrix, so decoding sums the
+  //columns for the bits of a word without building them again
+  parity_transpose = get_transpose( parity_check, code_length );
+
   //determine code words
   for( uint i = 0; i < find_power( 2, code_length ); i++ )
   {
@@ -169,17 +229,16 @@ CyclicCode::CyclicCode( vector< uint > param_generator,
     }
   }
 
-  //determine minimum distance of the code
+  //determine minimum distance of the code from the weights of all
+  //the code words at once
+  vector< uint8_t > weights( code_words.size() );
+  word_distances( 0, code_words.data(), code_words.size(), weights.data() );
   uint distance = UINT_MAX;
-  for( uint word : code_words )
+  for( uint i = 0; i < code_words.size(); i++ )
   {
-    if( word > 0 )
+    if( code_words.at( i ) > 0 && weights.at( i ) < distance )
     {
-      uint word_weight = hamming_distance( 0, word );
-      if( word_weight < distance )
-      {
-        distance = word_weight;
-      }
+      distance = weights.at( i );
     }
   }
   min_distance = distance;
@@ -199,28 +258,36 @@ vector< uint > CyclicCode::get_generator() const
   return generator;
 }
 
+vector< uint > CyclicCode::get_parity_check() const
+{
+  return parity_check;
+}
+
 uint CyclicCode::get_code_length() const
 {
   return code_length;
 }
 
-void CyclicCode::print_matrix( vector< uint > matrix,
+uint CyclicCode::get_min_distance() const
+{
+  return min_distance;
+}
+
+void CyclicCode::print_matrix( const vector< uint > &matrix,
+                               uint code_length ) const
+{
+  print_matrix( matrix.data(), matrix.size(), code_length );
+}
+
+void CyclicCode::print_matrix( const uint *matrix, uint num_rows,
                                uint code_length ) const
 {
   //find and print the bitwise representation of matrix
-  for( uint i = 0; i < matrix.size(); i++ )
+  for( uint i = 0; i < num_rows; i++ )
   {
-    uint this_code_word = matrix.at( i );
-    vector< uint > code_word_bitwise;
-    for( uint j = 0; j < code_length; j++ )
-    {
-      uint this_bit = ( this_code_word >> j ) & 1;
-      code_word_bitwise.push_back( this_bit );
-    }
-
     for( uint j = code_length - 1; j < UINT_MAX; j-- )
     {
-      cout << code_word_bitwise.at( j );
+      cout << ( ( matrix[ i ] >> j ) & 1 );
     }
     cout << endl;
   }
@@ -230,18 +297,11 @@ void CyclicCode::print_matrix( vector< uint > matrix,
 void CyclicCode::print_word_bitwise( uint word ) const
 {
   //find and print bitwise representation of codeword
-  vector< uint > code_word_bitwise;
-  for( uint j = 0; j < code_length; j++ )
+  for( uint i = code_length - 1; i < UINT_MAX; i-- )
   {
-    uint this_bit = ( word >> j ) & 1;
-    code_word_bitwise.push_back( this_bit );
+    cout << ( ( word >> i ) & 1 );
   }
-
-  for( uint i = code_length - 1; i < UINT_MAX; i-- )
-    {
-      cout << code_word_bitwise.at( i );
-    }
-    cout << endl;
+  cout << endl;
 }
 
 void CyclicCode::print_generator() const
@@ -270,38 +330,17 @@ void CyclicCode::print_words() const
 
 bool CyclicCode::is_code_word( uint word ) const
 {
-  //determine the product between the parity
-  //check matrix transpose and the word
-  vector< uint > vector_product;
-  for( uint col = 0; col < parity_check.size(); col++ )
+  //the word is in the code when its dot product with every row of
+  //the parity check matrix is zero, and each dot product is the
+  //parity of the bits the word shares with the row
+  for( uint row : parity_check )
   {
-    //determine the dot product between each column of the
-    //parity check matrix transpose and the word
-    uint dot_product = 0;
-    uint this_term = 0;
-    for( uint row = 0; row < code_length; row++ )
+    if( __builtin_parity( word & row ) != 0 )
     {
-      uint word_coordinate = ( word >> row ) & 1;
-      uint basis_vector_coordinate = ( parity_check.at( col )
-                                       >> row ) & 1;
-      
-      this_term = word_coordinate & basis_vector_coordinate;
-      dot_product = dot_product ^ this_term;
+      return false;
     }
-    vector_product.push_back( dot_product );
   }
-
-  //determine if the product is the zero vector
-  bool is_word = true;
-  for( uint this_word = 0; this_word < vector_product.size();
-       this_word++ )
-  {
-    if( vector_product.at( this_word ) != 0 )
-    {
-      is_word = false;
-    }
-  }
-  return is_word;
+  return true;
 }
 
 vector< uint > CyclicCode::get_transpose( vector< uint > matrix,
@@ -358,6 +397,19 @@ uint CyclicCode::find_power( uint base, uint exponent ) const
   }
 }
 
+uint CyclicCode::rotate_word( uint word, uint amount,
+                              uint word_length ) const
+{
+  if( amount == 0 )
+  {
+    return word;
+  }
+  uint word_mask = word_length < 32 ? ( 1u << word_length ) - 1 : UINT_MAX;
+  word &= word_mask;
+  return ( ( word << amount ) | ( word >> ( word_length - amount ) ) )
+    & word_mask;
+}
+
 uint CyclicCode::encode_word( uint word ) const
 {
   //determine the product of the word with the
@@ -379,6 +431,52 @@ uint CyclicCode::encode_word( uint word ) const
   return encoded_word;
 }
 
+uint CyclicCode::extract_message( uint code_word ) const
+{
+  //the rows of the generator matrix are x^i g(x), the last being
+  //g(x) itself, so the code word is u(x) g(x)
+  uint generator_polynomial = generator.at( generator.size() - 1 );
+  uint degree = 31 - __builtin_clz( generator_polynomial );
+  uint message = 0;
+  for( uint place_value = code_length - 1;
+       place_value != UINT_MAX && place_value >= degree; place_value-- )
+  {
+    if( ( ( code_word >> place_value ) & 1 ) == 1 )
+    {
+      message |= 1u << ( place_value - degree );
+      code_word ^= generator_polynomial << ( place_value - degree );
+    }
+  }
+  return message;
+}
+
+vector< uint > CyclicCode::decode_batch(
+  const vector< uint > &received_words ) const
+{
+  vector< uint > decoded_words;
+  decoded_words.reserve( received_words.size() );
+  for( uint word : received_words )
+  {
+    decoded_words.push_back( decode_word( word ) );
+  }
+  return decoded_words;
+}
+
+vector< uint > CyclicCode::nearest_neighbors(
+  const vector< uint > &received_words ) const
+{
+  vector< size_t > nearest( received_words.size() );
+  nearest_words( received_words.data(), received_words.size(),
+                 code_words.data(), code_words.size(), nearest.data() );
+  vector< uint > decoded_words;
+  decoded_words.reserve( received_words.size() );
+  for( size_t index : nearest )
+  {
+    decoded_words.push_back( code_words.at( index ) );
+  }
+  return decoded_words;
+}
+
 uint CyclicCode::decode_word( uint received_word ) const
 {
 
@@ -388,18 +486,21 @@ uint CyclicCode::decode_word( uint received_word ) const
     get_cyclic_shifts( received_word, code_length );
   */
 
-  vector< uint > cyclic_shifts =
-    get_cyclic_shifts( received_word, code_length );
+  //the shifts, syndromes and burst lengths all fit on the stack, so
+  //decoding never allocates
+  uint cyclic_shifts[ 32 ] = { 0 };
+  get_cyclic_shifts( received_word, code_length, cyclic_shifts );
 
-  vector< uint > received_cyclic_shifts = { cyclic_shifts.at( 0 ) };
-  
-  for( uint i = cyclic_shifts.size() - 1; i > 0; i-- )
+  uint received_cyclic_shifts[ 32 ] = { 0 };
+  received_cyclic_shifts[ 0 ] = cyclic_shifts[ 0 ];
+  for( uint i = 1; i < code_length; i++ )
   {
-    received_cyclic_shifts.push_back( cyclic_shifts.at( i ) );
+    received_cyclic_shifts[ i ] = cyclic_shifts[ code_length - i ];
   }
 
   //next find corresponding syndromes
-  vector< uint > syndromes = get_syndromes( received_word );
+  uint syndromes[ 32 ];
+  get_syndromes( received_word, syndromes );
   
   //TESTS
   /*
@@ -407,14 +508,14 @@ uint CyclicCode::decode_word( uint received_word ) const
   cout << "received word: ";
   print_word_bitwise( received_word );
   cout << "received word shifted cyclically: " << endl;
-  for( uint word : received_cyclic_shifts )
+  for( uint i = 0; i < code_length; i++ )
   {
-    print_word_bitwise( word );
+    print_word_bitwise( received_cyclic_shifts[ i ] );
   }
   cout << endl;
 
   cout << "the syndromes: " << endl;
-  print_matrix( syndromes, parity_check.size() );
+  print_matrix( syndromes, code_length, parity_check.size() );
 
   cout << "the parity check matrix:" << endl;
   print_matrix( parity_check, code_length );
@@ -424,12 +525,11 @@ uint CyclicCode::decode_word( uint received_word ) const
   
 
   //determine burst length of each syndrome
-  vector< uint > syndrome_burst_lengths;
-  for( uint k = 0; k < syndromes.size(); k++ )
+  uint syndrome_burst_lengths[ 32 ];
+  for( uint k = 0; k < code_length; k++ )
   {
-    syndrome_burst_lengths.push_back( get_burst_length(
-                                        syndromes.at( k ),
-                                        parity_check.size() ) );
+    syndrome_burst_lengths[ k ] = get_burst_length( syndromes[ k ],
+                                                    parity_check.size() );
   }
 
   //TESTING
@@ -437,10 +537,10 @@ uint CyclicCode::decode_word( uint received_word ) const
   cout << "received word: ";
   print_word_bitwise( received_word );
   cout << endl;
-  for( uint i = 0; i < syndromes.size(); i++  )
+  for( uint i = 0; i < code_length; i++  )
   {
-    cout << syndrome_burst_lengths.at( i ) << endl;
-    print_word_bitwise( syndromes.at( i ) );
+    cout << syndrome_burst_lengths[ i ] << endl;
+    print_word_bitwise( syndromes[ i ] );
     cout << endl;
   }
   cout << endl;
@@ -456,14 +556,14 @@ uint CyclicCode::decode_word( uint received_word ) const
   uint desired_burst_length = max_burst_length;
   while( desired_burst_length != UINT_MAX )
   {
-    while( !found_syndrome && which_syndrome < syndromes.size() )
+    while( !found_syndrome && which_syndrome < code_length )
     {
       uint syndrome_burst =
-        syndrome_burst_lengths.at( which_syndrome );
+        syndrome_burst_lengths[ which_syndrome ];
       if( syndrome_burst <= desired_burst_length )
       {
         found_syndrome = true;
-        light_syndrome = syndromes.at( which_syndrome );
+        light_syndrome = syndromes[ which_syndrome ];
         light_syndrome_pos = which_syndrome;
       }
       which_syndrome++;
@@ -482,14 +582,14 @@ uint CyclicCode::decode_word( uint received_word ) const
   //if( is_code_word( decoded_word ) )
   //{
   cout << "a word shifted cyclically: " << endl;
-  for( uint word : received_cyclic_shifts )
+  for( uint i = 0; i < code_length; i++ )
   {
-    print_word_bitwise( word );
+    print_word_bitwise( received_cyclic_shifts[ i ] );
   }
   cout << endl;
   
   cout << "the corresponding syndromes: " << endl;
-  print_matrix( syndromes, parity_check.size() );
+  print_matrix( syndromes, code_length, parity_check.size() );
   
   cout << "min distance : " << min_distance << endl;
   cout << "which syndrome: " << light_syndrome_pos << endl;
@@ -521,46 +621,11 @@ uint CyclicCode::decode_word( uint received_word ) const
     light_syndrome << ( code_length - parity_check.size() );
   
 
-  //shift light_syndrome by the proper degree and subtract
-  //remember place values
+  //shift light_syndrome by the proper degree and subtract, turning
+  //the bits down by the shift amount
   uint shift_amount = code_length - light_syndrome_pos;
-  vector< uint > syndrome_bit_place_values;
-  for( uint i = 0; i < code_length; i++ )
-  {
-    if( ( ( light_syndrome >> i ) & 1 ) == 1 )
-    {
-      syndrome_bit_place_values.push_back( i );
-    }
-  }
-
-  //shift place values
-  for( uint i = 0; i < syndrome_bit_place_values.size(); i++ )
-  {
-    syndrome_bit_place_values.at( i ) =
-      ( syndrome_bit_place_values.at( i )
-        + shift_amount ) % code_length;
-  }
-
-  //construct shifted syndrome
-  uint shifted_syndrome = 0;
-  uint temp = light_syndrome;
-  bool bit_wrap = false;
-  for( uint i = 1; i <= shift_amount; i++ )
-  {
-    if( ( light_syndrome & 1 ) == 1 )
-    {
-      bit_wrap = true;
-    }
-    
-    light_syndrome = light_syndrome >> 1;
-    if( bit_wrap )
-    {
-      light_syndrome += find_power( 2, code_length - 1 );
-    }
-    bit_wrap = false;
-  }
-  shifted_syndrome = light_syndrome;
-  light_syndrome = temp;
+  uint shifted_syndrome =
+    rotate_word( light_syndrome, light_syndrome_pos, code_length );
 
   decoded_word = received_word ^ shifted_syndrome;
 
@@ -569,14 +634,14 @@ uint CyclicCode::decode_word( uint received_word ) const
   //if( is_code_word( decoded_word ) )
   //{
   cout << "a word shifted cyclically: " << endl;
-  for( uint word : received_cyclic_shifts )
+  for( uint i = 0; i < code_length; i++ )
   {
-    print_word_bitwise( word );
+    print_word_bitwise( received_cyclic_shifts[ i ] );
   }
   cout << endl;
   
   cout << "the corresponding syndromes: " << endl;
-  print_matrix( syndromes, parity_check.size() );
+  print_matrix( syndromes, code_length, parity_check.size() );
   
   cout << "min distance : " << min_distance << endl;
   cout << "which syndrome: " << light_syndrome_pos << endl;
@@ -607,159 +672,75 @@ uint CyclicCode::decode_word( uint received_word ) const
 uint CyclicCode::hamming_distance( uint first_word,
                                    uint second_word ) const
 {
-  uint places_differ = first_word ^ second_word;
-  uint hamming_distance = 0;
-  for( uint place_value = 0; place_value < code_length;
-       place_value++ )
-  {
-    hamming_distance += ( ( places_differ >> place_value ) & 1 );
-  }
-  return hamming_distance;
+  uint word_mask = code_length < 32 ? ( 1u << code_length ) - 1 : UINT_MAX;
+  return word_weight( ( first_word ^ second_word ) & word_mask );
 }
 
-vector< uint > CyclicCode::get_cyclic_shifts(
-  uint word, uint word_length ) const
+void CyclicCode::get_cyclic_shifts( uint word, uint word_length,
+                                    uint *cyclic_shifts ) const
 {
-  
-  vector< uint > bit_place_values;
   for( uint i = 0; i < word_length; i++ )
   {
-    if( ( ( word >> i ) & 1 ) == 1 )
-    {
-      bit_place_values.push_back( i );
-    }
-  }
-  
-  vector< uint > cyclic_shifts = { word };
-  for( uint i = 1; i < word_length; i++ )
-  {
-    for( uint j = 0; j < bit_place_values.size(); j++ )
-    {
-      bit_place_values.at( j ) =
-        ( bit_place_values.at( j ) + 1 ) % ( word_length );
-    }
-
-    //create the corresponding word and add it to the list
-    uint cyclic_shift = 0;
-    for( uint place_value : bit_place_values )
-    {
-      cyclic_shift += find_power( 2, place_value );
-    }
-    
-    cyclic_shifts.push_back( cyclic_shift );
+    cyclic_shifts[ i ] = rotate_word( word, i, word_length );
   }
-  return cyclic_shifts;
 }
 
-vector< uint > CyclicCode::get_syndromes( uint received_word ) const
+void CyclicCode::get_syndromes( uint received_word,
+                                uint *syndromes ) const
 {
-  //determine cyclic shifts
-  vector< uint > cyclic_shifts =
-    get_cyclic_shifts( received_word, code_length );
-
-  //reorder to represent multiplication by x^i for 0 <= i < n
-  vector< uint > received_cyclic_shifts = { cyclic_shifts.at( 0 ) };
-  
-  for( uint i = cyclic_shifts.size() - 1; i > 0; i-- )
-  {
-    received_cyclic_shifts.push_back( cyclic_shifts.at( i ) );
-  }
-
-  vector< uint > syndromes;
-  vector< uint > parity_transpose = get_transpose( parity_check,
-                                                   code_length );
-  for( uint i = 0; i < received_cyclic_shifts.size(); i++ )
+  //the shift for multiplication by x^i for 0 <= i < n moves the
+  //bits down by i places, so sum the parity check columns of its
+  //bits
+  uint word_mask = code_length < 32 ? ( 1u << code_length ) - 1 : UINT_MAX;
+  for( uint i = 0; i < code_length; i++ )
   {
     uint syndrome = 0;
-    for( uint place_value = 0; place_value < parity_transpose.size();
-         place_value++ )
+    uint cyclic_shift =
+      rotate_word( received_word, ( code_length - i ) % code_length,
+                   code_length );
+    for( uint bits = cyclic_shift & word_mask; bits != 0;
+         bits &= bits - 1 )
     {
-      if( ( ( received_cyclic_shifts.at( i )
-              >> place_value ) & 1 ) == 1 )
-      {
-        syndrome ^= parity_transpose.at( parity_transpose.size()
-                                         - 1 - place_value );
-      }
+      uint place_value = __builtin_ctz( bits );
+      syndrome ^= parity_transpose[ code_length - 1 - place_value ];
     }
-    syndromes.push_back( syndrome );
+    syndromes[ i ] = syndrome;
   }
-  return syndromes;
 }
 
 uint CyclicCode::get_burst_length( uint syndrome,
                                  uint syndrome_length ) const
 {
-  vector< uint > cyclic_shifts =
-    get_cyclic_shifts( syndrome, syndrome_length );
+  uint syndrome_mask =
+    syndrome_length < 32 ? ( 1u << syndrome_length ) - 1 : UINT_MAX;
+  if( ( syndrome & syndrome_mask ) == 0 )
+  {
+    return 0;
+  }
 
+  //the shortest span from lowest to highest bit of any rotation
   uint burst_length = UINT_MAX;
-  for( uint j = 0; j < cyclic_shifts.size(); j++ )
+  for( uint j = 0; j < syndrome_length; j++ )
   {
-    vector< uint > bit_place_values;
-    for( uint i = 0; i < syndrome_length; i++ )
-    {
-      if( ( ( cyclic_shifts.at( j ) >> i ) & 1 ) == 1 )
-      {
-        bit_place_values.push_back( i );
-      }
-    }
-
-    if( !bit_place_values.empty() )
-    {
-      uint largest_pv = bit_place_values.at(
-        bit_place_values.size() - 1 );
-      uint smallest_pv = bit_place_values.at( 0 );
-      uint this_burst_length = largest_pv - smallest_pv + 1;
-      burst_length = this_burst_length < burst_length ?
-      this_burst_length : burst_length;
-    }
-    else
-    {
-      burst_length = 0;
-    }
+    uint cyclic_shift =
+      rotate_word( syndrome, j, syndrome_length ) & syndrome_mask;
+    uint this_burst_length =
+      32 - __builtin_clz( cyclic_shift ) - __builtin_ctz( cyclic_shift );
+    burst_length = this_burst_length < burst_length ?
+    this_burst_length : burst_length;
   }
   return burst_length;
 }
 
 uint CyclicCode::nearest_neighbor( uint received_word ) const
 {
-  //determine the coset for the received word
-  vector< uint > received_word_coset;
-  for( uint word = 0; word < code_words.size(); word++ )
-  {
-    uint coset_word = received_word ^ code_words.at( word );
-    received_word_coset.push_back( coset_word );
-  }
-  
-  //optional print cosets
-  /*
-    cout << "received word: " << received_word << endl;
-    cout << "corresponding coset: ";
-    for( uint i = 0; i < received_word_coset.size(); i++ )
-    {
-    cout << received_word_coset.at( i ) << " ";
-    }
-    cout << endl;
-    cout << endl;
-  */
-
-  //determine the least hamming weight in the coset
-  uint error_word = received_word_coset.at( 0 );
-  uint least_hw = UINT_MAX;
-  const uint ZERO_VECTOR = 0;
-  
-  for( uint i = 0; i < received_word_coset.size(); i++ )
-  {
-    uint this_hw = hamming_distance( ZERO_VECTOR,
-                                     received_word_coset.at( i ) );
-    if( this_hw < least_hw )
-    {
-      least_hw = this_hw;
-      error_word = received_word_coset.at( i );
-    }
-  }
-  //return the received word minus the error word
-  uint decoded_word = received_word ^ error_word;
+  //the word minus the nearest code word is the least weight word of
+  //its coset, so scan the code words directly without forming the
+  //coset
+  uint distance;
+  uint decoded_word = code_words.at(
+    nearest_word( received_word, code_words.data(), code_words.size(),
+                  distance ) );
   cout << "used NN decoding" << endl;
   return decoded_word;
 }
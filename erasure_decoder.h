@@ -0,0 +1,221 @@
+#ifndef ERASURE_DECODER_H
+#define ERASURE_DECODER_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include "cyclic_codes.h"
+
+using namespace std;
+
+/**
+ * An errors and erasures decoder for a cyclic code. Erased places
+ * are given by a mask alongside the received word. When only
+ * erasures occurred, the erased places are solved from the
+ * syndrome on the erased columns of the parity check matrix;
+ * otherwise the erased places are filled with all zeros and with
+ * all ones, each filling is decoded, and the better decoding is
+ * kept, which corrects e errors and f erasures when 2e + f < d.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class ErasureDecoder
+{
+public:
+  /**
+   * Constructor specifying the code
+   * @param code the cyclic code whose decoder is used
+   */
+  ErasureDecoder( const CyclicCode &code );
+
+  /**
+   * decode a word with erasures
+   * @param received_word the word to be decoded
+   * @param erasure_mask the erased places
+   * @return the decoded word
+   */
+  uint decode_word( uint received_word, uint erasure_mask ) const;
+
+  /**
+   * decode a batch of words with erasures
+   * @param received_words the words to be decoded
+   * @param erasure_masks the erased places of each word
+   * @return the decoded words
+   */
+  vector< uint > decode_batch( const vector< uint > &received_words,
+                               const vector< uint > &erasure_masks ) const;
+
+  /**
+   * solve for the erased places of a word with no errors
+   * @param received_word the word, erased places ignored
+   * @param erasure_mask the erased places
+   * @param decoded_word the word with erased places filled
+   * @return whether the erased columns can reach the syndrome
+   */
+  bool fill_erasures( uint received_word, uint erasure_mask,
+                      uint &decoded_word ) const;
+
+private:
+
+  /**
+   * determine the syndrome of a word
+   * @param word the word
+   * @return the syndrome, bit r from row r of the parity check matrix
+   */
+  uint get_syndrome( uint word ) const;
+
+  /**
+   * determine the highest set bit of a nonzero word
+   * @param word the word
+   * @return the word with only its highest bit set
+   */
+  static uint leading_bit( uint word );
+
+  const CyclicCode &code;
+  vector< uint > parity_check;
+  vector< uint > parity_columns;
+  uint code_length;
+};
+
+ErasureDecoder::ErasureDecoder( const CyclicCode &param_code )
+: code( param_code ), parity_check( param_code.get_parity_check() ),
+  code_length( param_code.get_code_length() )
+{
+  //h_i holds bit r of column i of the parity check matrix in place r
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    uint column = 0;
+    for( uint row = 0; row < parity_check.size(); row++ )
+    {
+      column |= ( ( parity_check.at( row ) >> place_value ) & 1 ) << row;
+    }
+    parity_columns.push_back( column );
+  }
+}
+
+uint ErasureDecoder::decode_word( uint received_word,
+                                  uint erasure_mask ) const
+{
+  if( erasure_mask == 0 )
+  {
+    return code.decode_word( received_word );
+  }
+
+  //pure erasures: the erased places alone account for the syndrome
+  uint decoded_word = 0;
+  if( fill_erasures( received_word, erasure_mask, decoded_word ) )
+  {
+    return decoded_word;
+  }
+
+  //errors and erasures: two trials, erasures all zero and all one,
+  //judged by their distance in the places that were not erased
+  uint zero_trial = code.decode_word( received_word & ~erasure_mask );
+  uint one_trial = code.decode_word( received_word | erasure_mask );
+  uint zero_distance =
+    __builtin_popcount( ( zero_trial ^ received_word ) & ~erasure_mask );
+  uint one_distance =
+    __builtin_popcount( ( one_trial ^ received_word ) & ~erasure_mask );
+  if( !code.is_code_word( zero_trial ) )
+  {
+    zero_distance = UINT_MAX;
+  }
+  if( !code.is_code_word( one_trial ) )
+  {
+    one_distance = UINT_MAX;
+  }
+  return one_distance < zero_distance ? one_trial : zero_trial;
+}
+
+vector< uint > ErasureDecoder::decode_batch(
+  const vector< uint > &received_words,
+  const vector< uint > &erasure_masks ) const
+{
+  vector< uint > decoded_words( received_words.size() );
+  for( uint i = 0; i < received_words.size(); i++ )
+  {
+    decoded_words.at( i ) = decode_word( received_words.at( i ),
+                                         erasure_masks.at( i ) );
+  }
+  return decoded_words;
+}
+
+bool ErasureDecoder::fill_erasures( uint received_word,
+                                    uint erasure_mask,
+                                    uint &decoded_word ) const
+{
+  //eliminate over the erased columns, each basis vector tagged with
+  //the erased places whose columns sum to it
+  uint basis[ 32 ];
+  uint basis_tags[ 32 ];
+  uint basis_size = 0;
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    if( ( ( erasure_mask >> place_value ) & 1 ) == 0 )
+    {
+      continue;
+    }
+    uint column = parity_columns.at( place_value );
+    uint tag = 1u << place_value;
+    for( uint i = 0; i < basis_size; i++ )
+    {
+      //each basis vector is reduced at its leading bit
+      if( ( column & leading_bit( basis[ i ] ) ) != 0 )
+      {
+        column ^= basis[ i ];
+        tag ^= basis_tags[ i ];
+      }
+    }
+    if( column != 0 )
+    {
+      //keep the basis reduced at the new vector's leading bit, which
+      //lies below the leading bit of any basis vector that has it
+      uint pivot = leading_bit( column );
+      for( uint i = 0; i < basis_size; i++ )
+      {
+        if( ( basis[ i ] & pivot ) != 0 )
+        {
+          basis[ i ] ^= column;
+          basis_tags[ i ] ^= tag;
+        }
+      }
+      basis[ basis_size ] = column;
+      basis_tags[ basis_size ] = tag;
+      basis_size++;
+    }
+  }
+
+  //reduce the syndrome of the word with the erasures cleared
+  uint cleared_word = received_word & ~erasure_mask;
+  uint syndrome = get_syndrome( cleared_word );
+  uint filling = 0;
+  for( uint i = 0; i < basis_size; i++ )
+  {
+    if( ( syndrome & leading_bit( basis[ i ] ) ) != 0 )
+    {
+      syndrome ^= basis[ i ];
+      filling ^= basis_tags[ i ];
+    }
+  }
+  decoded_word = cleared_word | filling;
+  return syndrome == 0;
+}
+
+uint ErasureDecoder::get_syndrome( uint word ) const
+{
+  uint syndrome = 0;
+  for( uint row = 0; row < parity_check.size(); row++ )
+  {
+    syndrome |= ( __builtin_popcount( word & parity_check.at( row ) ) & 1 )
+      << row;
+  }
+  return syndrome;
+}
+
+uint ErasureDecoder::leading_bit( uint word )
+{
+  return 1u << ( 31 - __builtin_clz( word ) );
+}
+
+#endif
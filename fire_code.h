@@ -0,0 +1,539 @@
+#ifndef FIRE_CODE_H
+#define FIRE_CODE_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+
+using namespace std;
+
+/**
+ * A Fire code, a cyclic code designed for the correction of a
+ * single burst of length at most b, with generator
+ * g(x) = ( x^( 2b - 1 ) + 1 ) p(x), where p(x) is irreducible of
+ * degree m >= b and its period e does not divide 2b - 1.
+ * The code length is n = lcm( 2b - 1, e ).
+ *
+ * Words are packed 32 bits to a uint, least significant bit first,
+ * so that bit i of the packed word is the coefficient of x^i.
+ * Since n is usually far past 32, every word is a vector< uint >
+ * of ( n + 31 ) / 32 entries.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class FireCode
+{
+public:
+  /**
+   * Constructor specifying only the burst length. The irreducible
+   * polynomial p(x) of least degree and value satisfying the Fire
+   * conditions is chosen automatically.
+   * @param burst_length the length of bursts to be corrected
+   */
+  FireCode( uint burst_length );
+
+  /**
+   * Constructor specifying the burst length and p(x)
+   * @param burst_length the length of bursts to be corrected
+   * @param irreducible_polynomial p(x), bit i the coefficient of x^i
+   */
+  FireCode( uint burst_length, uint irreducible_polynomial );
+
+  /**
+   * Return the code length n
+   */
+  uint get_code_length() const;
+
+  /**
+   * Return the dimension k of the code
+   */
+  uint get_dimension() const;
+
+  /**
+   * Return the length of the bursts the code corrects
+   */
+  uint get_burst_length() const;
+
+  /**
+   * Return the period e of p(x)
+   */
+  uint get_period() const;
+
+  /**
+   * Return the irreducible polynomial p(x)
+   */
+  uint get_irreducible_polynomial() const;
+
+  /**
+   * Return the generator polynomial g(x)
+   */
+  uint64_t get_generator_polynomial() const;
+
+  /**
+   * Print the parameters of the code
+   */
+  void print_parameters() const;
+
+  /**
+   * encode the word systematically, so that the message occupies
+   * the k highest places of the code word.
+   * @param word the k bit message, packed
+   * @return the n bit code word, packed
+   */
+  vector< uint > encode_word( vector< uint > word ) const;
+
+  /**
+   * extract the message from a systematic code word
+   * @param code_word the n bit code word, packed
+   * @return the k bit message, packed
+   */
+  vector< uint > extract_message( vector< uint > code_word ) const;
+
+  /**
+   * determine if the word is part of the code
+   * @param word the n bit word, packed
+   * @return if it is a code word or not
+   */
+  bool is_code_word( vector< uint > word ) const;
+
+  /**
+   * compute the syndrome r(x) mod g(x) of a received word
+   * @param word the n bit received word, packed
+   * @return the syndrome
+   */
+  uint64_t get_syndrome( vector< uint > word ) const;
+
+  /**
+   * decode the received word with burst trapping
+   * @param received_word the n bit received word, packed
+   * @return the corrected word, or the received word when no burst
+   * of length at most b could be trapped
+   */
+  vector< uint > decode_word( vector< uint > received_word ) const;
+
+  /**
+   * correct a single burst of length at most b in place. The
+   * syndrome register is shifted, one multiplication by x mod g(x)
+   * at a time, until the remainder of x^i r(x) is confined to its
+   * b lowest places, at which point it is the error burst shifted
+   * by i places.
+   * @param word the n bit received word, packed
+   * @return whether the word was a code word or a burst was trapped
+   */
+  bool correct_burst( vector< uint > &word ) const;
+
+private:
+
+  /**
+   * find the remainder of a polynomial divided by another
+   * @param dividend the dividend
+   * @param divisor the divisor, nonzero
+   * @return the remainder
+   */
+  static uint64_t polynomial_mod( uint64_t dividend, uint64_t divisor );
+
+  /**
+   * find the product of two polynomials with no overflow
+   * @param first the first polynomial
+   * @param second the second polynomial
+   * @return the product
+   */
+  static uint64_t polynomial_product( uint64_t first, uint64_t second );
+
+  /**
+   * determine the degree of a polynomial
+   * @param polynomial the polynomial, nonzero
+   * @return the degree
+   */
+  static uint polynomial_degree( uint64_t polynomial );
+
+  /**
+   * determine if a polynomial is irreducible by trial division
+   * @param polynomial the polynomial
+   * @return whether it is irreducible
+   */
+  static bool is_irreducible( uint64_t polynomial );
+
+  /**
+   * determine the period of a polynomial, the least e such that
+   * it divides x^e + 1
+   * @param polynomial the polynomial, with nonzero constant term
+   * @return the period, or 0 if there is none
+   */
+  static uint find_period( uint64_t polynomial );
+
+  /**
+   * determine the greatest common divisor of two integers
+   */
+  static uint find_gcd( uint first, uint second );
+
+  /**
+   * determine the parameters of the code from b and p(x)
+   */
+  void find_parameters();
+
+  uint burst_length;
+  uint irreducible_polynomial;
+  uint period;
+  uint64_t generator_polynomial;
+  uint redundancy;
+  uint code_length;
+};
+
+FireCode::FireCode( uint param_burst_length )
+: burst_length( param_burst_length ), irreducible_polynomial( 0 )
+{
+  //search for the least p(x) of degree m >= b which is irreducible
+  //and whose period does not divide 2b - 1; g(x) has degree
+  //2b - 1 + m, so there is none to find once that passes 63
+  uint burst_period = 2 * burst_length - 1;
+  bool found_polynomial = false;
+  for( uint degree = burst_length;
+       burst_length > 0 && degree < 32 && burst_period + degree < 64 &&
+         !found_polynomial;
+       degree++ )
+  {
+    for( uint64_t polynomial = ( 1ULL << degree ) + 1;
+         polynomial < ( 1ULL << ( degree + 1 ) ) && !found_polynomial;
+         polynomial += 2 )
+    {
+      if( is_irreducible( polynomial ) )
+      {
+        uint this_period = find_period( polynomial );
+        if( this_period != 0 && burst_period % this_period != 0 )
+        {
+          irreducible_polynomial = polynomial;
+          found_polynomial = true;
+        }
+      }
+    }
+  }
+
+  if( !found_polynomial )
+  {
+    cout << "no suitable p(x) for burst length " << burst_length
+         << endl;
+  }
+  find_parameters();
+}
+
+FireCode::FireCode( uint param_burst_length,
+                    uint param_irreducible_polynomial )
+: burst_length( param_burst_length ),
+  irreducible_polynomial( param_irreducible_polynomial )
+{
+  //check the Fire conditions on p(x)
+  if( burst_length == 0 )
+  {
+    cout << "the burst length must be at least 1." << endl;
+  }
+  else if( !is_irreducible( irreducible_polynomial ) )
+  {
+    cout << "p(x) is not irreducible." << endl;
+  }
+  else if( polynomial_degree( irreducible_polynomial ) < burst_length )
+  {
+    cout << "the degree of p(x) is less than the burst length."
+         << endl;
+  }
+  else if( find_period( irreducible_polynomial ) == 0 ||
+           ( 2 * burst_length - 1 )
+           % find_period( irreducible_polynomial ) == 0 )
+  {
+    cout << "the period of p(x) divides 2b - 1." << endl;
+  }
+  find_parameters();
+}
+
+void FireCode::find_parameters()
+{
+  uint burst_period = 2 * burst_length - 1;
+  period = irreducible_polynomial > 1 ?
+    find_period( irreducible_polynomial ) : 0;
+
+  //g(x) = ( x^( 2b - 1 ) + 1 ) p(x), n = lcm( 2b - 1, e ); a product
+  //past degree 63 comes back as 0
+  generator_polynomial = burst_length > 0 && burst_period < 64 ?
+    polynomial_product( ( 1ULL << burst_period ) + 1,
+                        irreducible_polynomial ) : 0;
+  redundancy = generator_polynomial > 1 ?
+    polynomial_degree( generator_polynomial ) : 0;
+  if( period == 0 || generator_polynomial == 0 || redundancy >= 64 )
+  {
+    if( burst_length > 0 && period != 0 )
+    {
+      cout << "the syndrome register is limited to 63 bits." << endl;
+    }
+    code_length = 0;
+    redundancy = 0;
+    return;
+  }
+  code_length = burst_period / find_gcd( burst_period, period )
+    * period;
+}
+
+uint FireCode::get_code_length() const
+{
+  return code_length;
+}
+
+uint FireCode::get_dimension() const
+{
+  return code_length - redundancy;
+}
+
+uint FireCode::get_burst_length() const
+{
+  return burst_length;
+}
+
+uint FireCode::get_period() const
+{
+  return period;
+}
+
+uint FireCode::get_irreducible_polynomial() const
+{
+  return irreducible_polynomial;
+}
+
+uint64_t FireCode::get_generator_polynomial() const
+{
+  return generator_polynomial;
+}
+
+void FireCode::print_parameters() const
+{
+  cout << "Fire code for bursts of length " << burst_length << endl;
+  cout << "p(x): " << irreducible_polynomial << endl;
+  cout << "period of p(x): " << period << endl;
+  cout << "generator: " << generator_polynomial << endl;
+  cout << "( n, k ): ( " << code_length << ", " << get_dimension()
+       << " )" << endl;
+  cout << endl;
+}
+
+vector< uint > FireCode::encode_word( vector< uint > word ) const
+{
+  uint dimension = get_dimension();
+  vector< uint > code_word( ( code_length + 31 ) / 32, 0 );
+  if( code_length == 0 )
+  {
+    return code_word;
+  }
+
+  //divide x^( n - k ) u(x) by g(x) with the division register,
+  //feeding the message from its highest place down
+  uint64_t top_bit = 1ULL << ( redundancy - 1 );
+  uint64_t register_mask = ( top_bit << 1 ) - 1;
+  uint64_t feedback_taps = generator_polynomial & register_mask;
+  uint64_t division_register = 0;
+  for( uint place_value = dimension - 1; place_value != UINT_MAX;
+       place_value-- )
+  {
+    uint message_bit = ( word.at( place_value / 32 )
+                         >> ( place_value % 32 ) ) & 1;
+    bool feedback = ( ( division_register & top_bit ) != 0 )
+      ^ ( message_bit == 1 );
+    division_register = ( division_register << 1 ) & register_mask;
+    if( feedback )
+    {
+      division_register ^= feedback_taps;
+    }
+
+    //place the message bit in the high places of the code word
+    uint code_place = place_value + redundancy;
+    code_word.at( code_place / 32 ) |= message_bit << ( code_place % 32 );
+  }
+
+  //the remainder occupies the low places
+  for( uint place_value = 0; place_value < redundancy; place_value++ )
+  {
+    uint parity_bit = ( division_register >> place_value ) & 1;
+    code_word.at( place_value / 32 ) |= parity_bit << ( place_value % 32 );
+  }
+  return code_word;
+}
+
+vector< uint > FireCode::extract_message( vector< uint > code_word ) const
+{
+  uint dimension = get_dimension();
+  vector< uint > message( ( dimension + 31 ) / 32, 0 );
+  for( uint place_value = 0; place_value < dimension; place_value++ )
+  {
+    uint code_place = place_value + redundancy;
+    uint this_bit = ( code_word.at( code_place / 32 )
+                      >> ( code_place % 32 ) ) & 1;
+    message.at( place_value / 32 ) |= this_bit << ( place_value % 32 );
+  }
+  return message;
+}
+
+bool FireCode::is_code_word( vector< uint > word ) const
+{
+  return get_syndrome( word ) == 0;
+}
+
+uint64_t FireCode::get_syndrome( vector< uint > word ) const
+{
+  //shift the word into the division register, highest place first
+  uint64_t top_bit = 1ULL << redundancy;
+  uint64_t syndrome = 0;
+  for( uint place_value = code_length - 1; place_value != UINT_MAX;
+       place_value-- )
+  {
+    syndrome = ( syndrome << 1 )
+      | ( ( word.at( place_value / 32 ) >> ( place_value % 32 ) ) & 1 );
+    if( ( syndrome & top_bit ) != 0 )
+    {
+      syndrome ^= generator_polynomial;
+    }
+  }
+  return syndrome;
+}
+
+vector< uint > FireCode::decode_word( vector< uint > received_word ) const
+{
+  correct_burst( received_word );
+  return received_word;
+}
+
+bool FireCode::correct_burst( vector< uint > &word ) const
+{
+  uint64_t syndrome = get_syndrome( word );
+  if( syndrome == 0 )
+  {
+    return true;
+  }
+
+  //s_i = x^i r(x) mod g(x); a burst e(x) of length at most b is
+  //trapped once x^i e(x) mod ( x^n - 1 ) lies in places 0 to b - 1,
+  //because it is then its own remainder.
+  uint64_t top_bit = 1ULL << redundancy;
+  for( uint shift = 0; shift < code_length; shift++ )
+  {
+    if( ( syndrome >> burst_length ) == 0 )
+    {
+      //e(x) = x^( n - i ) s_i(x) mod ( x^n - 1 )
+      for( uint place_value = 0; place_value < burst_length;
+           place_value++ )
+      {
+        if( ( ( syndrome >> place_value ) & 1 ) == 1 )
+        {
+          uint error_place =
+            ( place_value + code_length - shift ) % code_length;
+          word.at( error_place / 32 ) ^= 1u << ( error_place % 32 );
+        }
+      }
+      return true;
+    }
+
+    syndrome = syndrome << 1;
+    if( ( syndrome & top_bit ) != 0 )
+    {
+      syndrome ^= generator_polynomial;
+    }
+  }
+  return false;
+}
+
+uint64_t FireCode::polynomial_mod( uint64_t dividend, uint64_t divisor )
+{
+  uint divisor_degree = polynomial_degree( divisor );
+  for( uint place_value = 63; place_value != UINT_MAX &&
+         place_value >= divisor_degree; place_value-- )
+  {
+    if( ( ( dividend >> place_value ) & 1 ) == 1 )
+    {
+      dividend ^= divisor << ( place_value - divisor_degree );
+    }
+  }
+  return dividend;
+}
+
+uint64_t FireCode::polynomial_product( uint64_t first, uint64_t second )
+{
+  uint64_t product = 0;
+  for( uint place_value = 0; place_value < 64; place_value++ )
+  {
+    if( ( ( second >> place_value ) & 1 ) == 1 )
+    {
+      //overflow of the product past 63 is flagged as 0
+      if( first != 0 && polynomial_degree( first ) + place_value > 63 )
+      {
+        return 0;
+      }
+      product ^= first << place_value;
+    }
+  }
+  return product;
+}
+
+uint FireCode::polynomial_degree( uint64_t polynomial )
+{
+  return 63 - __builtin_clzll( polynomial );
+}
+
+bool FireCode::is_irreducible( uint64_t polynomial )
+{
+  if( polynomial < 2 )
+  {
+    return false;
+  }
+
+  //trial division by every polynomial of degree at most half
+  uint degree = polynomial_degree( polynomial );
+  for( uint64_t divisor = 2; divisor < ( 1ULL << ( degree / 2 + 1 ) );
+       divisor++ )
+  {
+    if( polynomial_mod( polynomial, divisor ) == 0 )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint FireCode::find_period( uint64_t polynomial )
+{
+  if( ( polynomial & 1 ) == 0 )
+  {
+    return 0;
+  }
+
+  //multiply by x mod p(x) until we return to 1
+  uint degree = polynomial_degree( polynomial );
+  if( degree == 0 )
+  {
+    return 0;
+  }
+  uint64_t top_bit = 1ULL << degree;
+  uint64_t power = 1;
+  for( uint64_t exponent = 1; exponent < ( 1ULL << degree ); exponent++ )
+  {
+    power = power << 1;
+    if( ( power & top_bit ) != 0 )
+    {
+      power ^= polynomial;
+    }
+    if( power == 1 )
+    {
+      return exponent;
+    }
+  }
+  return 0;
+}
+
+uint FireCode::find_gcd( uint first, uint second )
+{
+  while( second != 0 )
+  {
+    uint remainder = first % second;
+    first = second;
+    second = remainder;
+  }
+  return first;
+}
+
+#endif
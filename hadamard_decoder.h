@@ -0,0 +1,247 @@
+#ifndef HADAMARD_DECODER_H
+#define HADAMARD_DECODER_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cfloat>
+#include <cmath>
+#include "cyclic_codes.h"
+
+using namespace std;
+
+/**
+ * A maximum likelihood decoder for simplex codes, the duals of the
+ * cyclic Hamming codes, and for the punctured first order Reed-Muller
+ * codes, which are simplex codes with the all ones word added.
+ * Over a basis of the simplex part, the columns of the generator
+ * matrix are the 2^m - 1 distinct nonzero vectors v_i, and the code
+ * word for a message u has u . v_i in place i, so the correlation of
+ * the received word with every code word is one fast Walsh-Hadamard
+ * transform of the received values placed at v_i, in m 2^m steps.
+ * Any other code is decoded by the code itself, from the hard
+ * decisions of the received values.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class HadamardDecoder
+{
+public:
+  /**
+   * Constructor specifying the code
+   * @param code the cyclic code to decode
+   */
+  HadamardDecoder( const CyclicCode &code );
+
+  /**
+   * determine if the dual of the code is a Hamming code, with or
+   * without the all ones word added to the code
+   * @return if the code can be decoded by the transform
+   */
+  bool is_applicable() const;
+
+  /**
+   * decode a hard decision word
+   * @param received_word the word to be decoded
+   * @return the nearest code word, or the code's decoding if the
+   * transform does not apply
+   */
+  uint decode_word( uint received_word ) const;
+
+  /**
+   * decode a word from its log likelihood ratios
+   * @param llrs the log likelihood ratios log( P( 0 ) / P( 1 ) ) of
+   * the n places
+   * @return the most likely code word, the code's decoding of the
+   * hard decisions if the transform does not apply, or 0 if there
+   * are not n ratios
+   */
+  uint decode_word( const vector< float > &llrs ) const;
+
+private:
+
+  /**
+   * find the code word best correlated with the received values
+   * @param values the received values, positive for a 0
+   * @return the code word
+   */
+  uint correlate( const float *values ) const;
+
+  const CyclicCode &code;
+  vector< uint > basis;
+  vector< uint > columns;
+  uint code_length;
+  uint all_ones;
+  bool has_all_ones;
+  bool applicable;
+};
+
+HadamardDecoder::HadamardDecoder( const CyclicCode &param_code )
+: code( param_code ), code_length( param_code.get_code_length() ),
+  has_all_ones( false ),
+  applicable( false )
+{
+  all_ones = code_length < 32 ? ( 1u << code_length ) - 1 : UINT_MAX;
+  has_all_ones = code.is_code_word( all_ones );
+
+  //reduce the generator rows to a basis of a complement of the all
+  //ones word, pivoting on the leading bit of each kept row
+  vector< uint > pivots;
+  if( has_all_ones )
+  {
+    pivots.push_back( all_ones );
+  }
+  for( uint row : code.get_generator() )
+  {
+    uint reduced_row = row;
+    for( uint pivot : pivots )
+    {
+      uint leading = 1u << ( 31 - __builtin_clz( pivot ) );
+      if( ( reduced_row & leading ) != 0 )
+      {
+        reduced_row ^= pivot;
+      }
+    }
+    if( reduced_row != 0 )
+    {
+      //keep the pivot rows reduced at each other's leading bits
+      uint leading = 1u << ( 31 - __builtin_clz( reduced_row ) );
+      for( uint &pivot : pivots )
+      {
+        if( ( pivot & leading ) != 0 )
+        {
+          pivot ^= reduced_row;
+        }
+      }
+      pivots.push_back( reduced_row );
+      basis.push_back( row );
+    }
+  }
+
+  //column i of the simplex part, bit r from basis row r; n < 32
+  //holds at most 5 basis rows, so the transform fits in 32 values
+  uint dimension = basis.size();
+  applicable = dimension <= 5 && code_length == ( 1u << dimension ) - 1;
+  vector< bool > seen( applicable ? 1u << dimension : 0, false );
+  for( uint place_value = 0; place_value < code_length && applicable;
+       place_value++ )
+  {
+    uint column = 0;
+    for( uint row = 0; row < dimension; row++ )
+    {
+      column |= ( ( basis.at( row ) >> place_value ) & 1 ) << row;
+    }
+    if( seen.at( column ) )
+    {
+      applicable = false;
+    }
+    seen.at( column ) = true;
+    columns.push_back( column );
+  }
+}
+
+bool HadamardDecoder::is_applicable() const
+{
+  return applicable;
+}
+
+uint HadamardDecoder::decode_word( uint received_word ) const
+{
+  //the transform only has room for the columns of a simplex code
+  if( !applicable )
+  {
+    return code.decode_word( received_word );
+  }
+  float values[ 32 ];
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    values[ place_value ] =
+      1.0f - 2.0f * ( ( received_word >> place_value ) & 1 );
+  }
+  return correlate( values );
+}
+
+uint HadamardDecoder::decode_word( const vector< float > &llrs ) const
+{
+  if( llrs.size() != code_length )
+  {
+    cout << "expected " << code_length << " log likelihood ratios, got "
+         << llrs.size() << "." << endl;
+    return 0;
+  }
+  if( !applicable )
+  {
+    uint received_word = 0;
+    for( uint place_value = 0; place_value < code_length; place_value++ )
+    {
+      received_word |= static_cast< uint >( llrs[ place_value ] < 0 )
+        << place_value;
+    }
+    return code.decode_word( received_word );
+  }
+  return correlate( llrs.data() );
+}
+
+uint HadamardDecoder::correlate( const float *values ) const
+{
+  //place the received values at the columns they belong to; the
+  //transform is on the stack so decoding never allocates
+  uint transform_size = 1u << basis.size();
+  float transform[ 32 ] = { 0 };
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    transform[ columns[ place_value ] ] = values[ place_value ];
+  }
+
+  //fast Walsh-Hadamard transform; the inner loop is a plain
+  //butterfly over contiguous blocks, so it vectorizes
+  for( uint half = 1; half < transform_size; half *= 2 )
+  {
+    for( uint block = 0; block < transform_size; block += 2 * half )
+    {
+      float *low = transform + block;
+      float *high = low + half;
+      for( uint i = 0; i < half; i++ )
+      {
+        float sum = low[ i ] + high[ i ];
+        float difference = low[ i ] - high[ i ];
+        low[ i ] = sum;
+        high[ i ] = difference;
+      }
+    }
+  }
+
+  //the transform at u is the correlation with the code word for u,
+  //and its negative is the correlation with the complement
+  uint best_message = 0;
+  float best_correlation = -FLT_MAX;
+  bool complement = false;
+  for( uint message = 0; message < transform_size; message++ )
+  {
+    float correlation = has_all_ones ?
+      fabs( transform[ message ] ) : transform[ message ];
+    if( correlation > best_correlation )
+    {
+      best_correlation = correlation;
+      best_message = message;
+      complement = transform[ message ] < 0;
+    }
+  }
+
+  uint decoded_word = 0;
+  for( uint row = 0; row < basis.size(); row++ )
+  {
+    if( ( ( best_message >> row ) & 1 ) == 1 )
+    {
+      decoded_word ^= basis.at( row );
+    }
+  }
+  if( has_all_ones && complement )
+  {
+    decoded_word ^= all_ones;
+  }
+  return decoded_word;
+}
+
+#endif
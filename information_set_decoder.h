@@ -0,0 +1,400 @@
+#ifndef INFORMATION_SET_DECODER_H
+#define INFORMATION_SET_DECODER_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+using namespace std;
+
+/**
+ * An information set decoder of Lee and Brickell for cyclic codes
+ * too long for syndrome tables or trellises. Each iteration reduces
+ * the generator matrix on a random information set, re-encodes the
+ * received word from that set and from every change of it in at
+ * most two places, and keeps the candidate nearest the received
+ * word. The iterations for one word run on several threads and stop
+ * as soon as one finds a code word within the error weight; a batch
+ * of words is instead shared out among the threads a word at a time,
+ * so no threads are started per word.
+ *
+ * Words are packed 32 bits to a uint, least significant bit first,
+ * so bit i of the packed word is the coefficient of x^i.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class InformationSetDecoder
+{
+public:
+  /**
+   * Constructor specifying a cyclic code and the search
+   * @param code_length the length of the code
+   * @param generator_polynomial g(x), packed
+   * @param error_weight the weight of error at which the search
+   * stops, usually ( d - 1 ) / 2
+   * @param max_iterations the number of information sets to try
+   * @param num_threads the number of threads to search with
+   */
+  InformationSetDecoder( uint code_length,
+                         vector< uint > generator_polynomial,
+                         uint error_weight, uint max_iterations,
+                         uint num_threads );
+
+  /**
+   * Return the code length
+   */
+  uint get_code_length() const;
+
+  /**
+   * Return the dimension of the code
+   */
+  uint get_dimension() const;
+
+  /**
+   * decode the received word, starting the search threads for it
+   * @param received_word the n bit received word, packed; bits past
+   * place n - 1 are ignored
+   * @return the nearest code word found
+   */
+  vector< uint > decode_word( vector< uint > received_word ) const;
+
+  /**
+   * decode a batch of received words. Each thread takes a
+   * contiguous share of the words and searches for one at a time
+   * @param received_words the n bit received words, packed
+   * @return the nearest code word found for each
+   */
+  vector< vector< uint > > decode_batch(
+    const vector< vector< uint > > &received_words ) const;
+
+private:
+
+  /**
+   * decode a received word on a number of threads, the calling
+   * thread among them
+   * @param received_word the received word, packed
+   * @param search_threads the number of threads to search with
+   * @param seeds the source of the seed of each thread
+   * @return the nearest code word found
+   */
+  vector< uint > decode_on_threads( vector< uint > received_word,
+                                    uint search_threads,
+                                    mt19937 &seeds ) const;
+
+  /**
+   * try information sets until the search is over
+   * @param received_word the received word
+   * @param num_iterations the number of information sets to try
+   * @param seed the seed of this thread
+   * @param best_word the nearest code word found by any thread
+   * @param best_weight the weight of its error
+   * @param best_mutex the lock on the best word
+   * @param found whether some thread has found a code word within
+   * the error weight
+   */
+  void search( const vector< uint > &received_word, uint num_iterations,
+               uint seed, vector< uint > &best_word, uint &best_weight,
+               mutex &best_mutex, atomic< bool > &found ) const;
+
+  /**
+   * determine the weight of the sum of two packed words
+   */
+  uint distance( const uint *first_word, const uint *second_word ) const;
+
+  vector< uint > generator;
+  uint code_length;
+  uint dimension;
+  uint num_packed;
+  uint error_weight;
+  uint max_iterations;
+  uint num_threads;
+};
+
+InformationSetDecoder::InformationSetDecoder(
+  uint param_code_length, vector< uint > generator_polynomial,
+  uint param_error_weight, uint param_max_iterations,
+  uint param_num_threads )
+: code_length( param_code_length ), error_weight( param_error_weight ),
+  max_iterations( param_max_iterations ),
+  num_threads( param_num_threads > 0 ? param_num_threads : 1 )
+{
+  num_packed = ( code_length + 31 ) / 32;
+
+  //determine degree of generator polynomial
+  uint degree = code_length - 1;
+  while( degree != UINT_MAX && ( degree / 32 >= generator_polynomial.size()
+           || ( ( generator_polynomial.at( degree / 32 )
+                  >> ( degree % 32 ) ) & 1 ) == 0 ) )
+  {
+    degree--;
+  }
+  dimension = code_length - degree;
+
+  //the rows of the generator matrix are x^i g(x), 0 <= i < k,
+  //stored one after the other
+  generator.assign( dimension * num_packed, 0 );
+  for( uint row = 0; row < dimension; row++ )
+  {
+    for( uint place_value = 0; place_value <= degree; place_value++ )
+    {
+      if( ( ( generator_polynomial.at( place_value / 32 )
+              >> ( place_value % 32 ) ) & 1 ) == 1 )
+      {
+        uint code_place = place_value + row;
+        generator.at( row * num_packed + code_place / 32 ) |=
+          1u << ( code_place % 32 );
+      }
+    }
+  }
+}
+
+uint InformationSetDecoder::get_code_length() const
+{
+  return code_length;
+}
+
+uint InformationSetDecoder::get_dimension() const
+{
+  return dimension;
+}
+
+vector< uint > InformationSetDecoder::decode_word(
+  vector< uint > received_word ) const
+{
+  random_device seed_source;
+  mt19937 seeds( seed_source() );
+  return decode_on_threads( received_word, num_threads, seeds );
+}
+
+vector< vector< uint > > InformationSetDecoder::decode_batch(
+  const vector< vector< uint > > &received_words ) const
+{
+  //words are independent, so each thread takes a contiguous share
+  //and gives each of its words the whole iteration budget
+  uint num_words = received_words.size();
+  uint batch_threads = num_threads < num_words ? num_threads : num_words;
+  vector< vector< uint > > decoded_words( num_words );
+  random_device seed_source;
+  vector< thread > threads;
+  for( uint t = 0; t < batch_threads; t++ )
+  {
+    uint first = num_words * t / batch_threads;
+    uint last = num_words * ( t + 1 ) / batch_threads;
+    uint seed = seed_source();
+    threads.push_back( thread( [ this, &received_words, &decoded_words,
+                                 first, last, seed ]()
+    {
+      mt19937 seeds( seed );
+      for( uint i = first; i < last; i++ )
+      {
+        decoded_words.at( i ) =
+          decode_on_threads( received_words.at( i ), 1, seeds );
+      }
+    } ) );
+  }
+  for( thread &worker : threads )
+  {
+    worker.join();
+  }
+  return decoded_words;
+}
+
+vector< uint > InformationSetDecoder::decode_on_threads(
+  vector< uint > received_word, uint search_threads, mt19937 &seeds ) const
+{
+  //the distances count every bit of the packed words, so clear any
+  //bits past the end of the code
+  received_word.resize( num_packed, 0 );
+  if( code_length % 32 != 0 )
+  {
+    received_word.back() &= ( 1u << ( code_length % 32 ) ) - 1;
+  }
+
+  vector< uint > best_word = received_word;
+  uint best_weight = UINT_MAX;
+  mutex best_mutex;
+  atomic< bool > found( false );
+
+  //split the iterations among the threads
+  vector< thread > threads;
+  uint iterations_per_thread =
+    ( max_iterations + search_threads - 1 ) / search_threads;
+  for( uint i = 1; i < search_threads; i++ )
+  {
+    threads.push_back( thread( &InformationSetDecoder::search, this,
+                               cref( received_word ),
+                               iterations_per_thread, uint( seeds() ),
+                               ref( best_word ), ref( best_weight ),
+                               ref( best_mutex ), ref( found ) ) );
+  }
+  search( received_word, iterations_per_thread, seeds(),
+          best_word, best_weight, best_mutex, found );
+  for( thread &this_thread : threads )
+  {
+    this_thread.join();
+  }
+  return best_word;
+}
+
+void InformationSetDecoder::search( const vector< uint > &received_word,
+                                    uint num_iterations, uint seed,
+                                    vector< uint > &best_word,
+                                    uint &best_weight, mutex &best_mutex,
+                                    atomic< bool > &found ) const
+{
+  mt19937 generator_random( seed );
+  vector< uint > rows( generator.size() );
+  vector< uint > columns( code_length );
+  vector< uint > pivots( dimension );
+  vector< uint > candidate( num_packed );
+  vector< uint > pair_candidate( num_packed );
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    columns.at( place_value ) = place_value;
+  }
+
+  uint local_best = UINT_MAX;
+  for( uint iteration = 0; iteration < num_iterations &&
+         !found.load( memory_order_relaxed ); iteration++ )
+  {
+    //reduce the generator matrix, taking pivots in a random order
+    //of the columns, so the pivots form a random information set
+    shuffle( columns.begin(), columns.end(), generator_random );
+    rows = generator;
+    uint rank = 0;
+    for( uint i = 0; i < code_length && rank < dimension; i++ )
+    {
+      uint column = columns.at( i );
+      uint word = column / 32;
+      uint mask = 1u << ( column % 32 );
+      uint pivot_row = rank;
+      while( pivot_row < dimension &&
+             ( rows.at( pivot_row * num_packed + word ) & mask ) == 0 )
+      {
+        pivot_row++;
+      }
+      if( pivot_row == dimension )
+      {
+        continue;
+      }
+      uint *pivot = &rows.at( rank * num_packed );
+      if( pivot_row != rank )
+      {
+        swap_ranges( pivot, pivot + num_packed,
+                     &rows.at( pivot_row * num_packed ) );
+      }
+      for( uint row = 0; row < dimension; row++ )
+      {
+        uint *this_row = &rows.at( row * num_packed );
+        if( row != rank && ( this_row[ word ] & mask ) != 0 )
+        {
+          for( uint j = 0; j < num_packed; j++ )
+          {
+            this_row[ j ] ^= pivot[ j ];
+          }
+        }
+      }
+      pivots.at( rank ) = column;
+      rank++;
+    }
+
+    //re-encode the received word from the information set
+    fill( candidate.begin(), candidate.end(), 0 );
+    for( uint row = 0; row < rank; row++ )
+    {
+      uint column = pivots.at( row );
+      if( ( ( received_word.at( column / 32 ) >> ( column % 32 ) ) & 1 ) == 1 )
+      {
+        for( uint j = 0; j < num_packed; j++ )
+        {
+          candidate.at( j ) ^= rows.at( row * num_packed + j );
+        }
+      }
+    }
+
+    //Lee-Brickell: also try changing one or two information places
+    uint iteration_best = distance( candidate.data(),
+                                    received_word.data() );
+    int best_first = -1;
+    int best_second = -1;
+    for( uint first = 0; first < rank; first++ )
+    {
+      const uint *first_row = &rows.at( first * num_packed );
+      for( uint j = 0; j < num_packed; j++ )
+      {
+        pair_candidate.at( j ) = candidate.at( j ) ^ first_row[ j ];
+      }
+      uint weight = distance( pair_candidate.data(), received_word.data() );
+      if( weight < iteration_best )
+      {
+        iteration_best = weight;
+        best_first = first;
+        best_second = -1;
+      }
+      for( uint second = first + 1; second < rank; second++ )
+      {
+        const uint *second_row = &rows.at( second * num_packed );
+        uint pair_weight = 0;
+        for( uint j = 0; j < num_packed; j++ )
+        {
+          pair_weight += __builtin_popcount( pair_candidate.at( j )
+                                             ^ second_row[ j ]
+                                             ^ received_word.at( j ) );
+        }
+        if( pair_weight < iteration_best )
+        {
+          iteration_best = pair_weight;
+          best_first = first;
+          best_second = second;
+        }
+      }
+    }
+
+    if( iteration_best >= local_best )
+    {
+      continue;
+    }
+    local_best = iteration_best;
+    for( int this_row : { best_first, best_second } )
+    {
+      if( this_row >= 0 )
+      {
+        for( uint j = 0; j < num_packed; j++ )
+        {
+          candidate.at( j ) ^= rows.at( this_row * num_packed + j );
+        }
+      }
+    }
+
+    //publish the improvement
+    lock_guard< mutex > lock( best_mutex );
+    if( iteration_best < best_weight )
+    {
+      best_weight = iteration_best;
+      best_word = candidate;
+    }
+    if( best_weight <= error_weight )
+    {
+      found.store( true, memory_order_relaxed );
+    }
+  }
+}
+
+uint InformationSetDecoder::distance( const uint *first_word,
+                                      const uint *second_word ) const
+{
+  uint weight = 0;
+  for( uint j = 0; j < num_packed; j++ )
+  {
+    weight += __builtin_popcount( first_word[ j ] ^ second_word[ j ] );
+  }
+  return weight;
+}
+
+#endif
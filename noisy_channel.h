@@ -3,6 +3,8 @@
 
 
 #include <climits>
+#include <cstdint>
+#include <cmath>
 #include <iostream>
 #include <vector>
 #include <cfloat>
@@ -32,6 +34,56 @@ uint find_power( uint base, uint exponent );
 void burst_noise( vector< uint > &message, uint code_length,
                   uint burst_size );
 
+/*
+ * erases places of the message, each independently with the given
+ * probability, as on a binary erasure channel. Erased places are
+ * cleared to 0 in the message.
+ * @param message the message to be sent
+ * @param code_length the length of the code
+ * @param erasure_probability the probability a place is erased
+ * @return the erased places of each word
+ */
+vector< uint > erasure_noise( vector< uint > &message,
+                              uint code_length,
+                              float erasure_probability );
+
+/*
+ * fills a buffer with Gaussian noise by the Box-Muller method.
+ * Eight xorshift generators run side by side so that the loops
+ * over them vectorize.
+ * @param samples the buffer to be filled
+ * @param sigma the standard deviation of the noise
+ * @param seed the seed of the generators
+ */
+void gaussian_noise( vector< float > &samples, float sigma,
+                     uint64_t seed );
+
+/*
+ * sends the message over a BPSK channel with additive white
+ * Gaussian noise. Each bit b is sent as the symbol 1 - 2b.
+ * @param message the message to be sent
+ * @param code_length the length of the code
+ * @param code_rate the rate k / n of the code
+ * @param ebn0_db the ratio Eb/N0 in decibels
+ * @param noise_state the state of the noise generator, seeded once
+ * by the caller and advanced by each call, so successive frames get
+ * independent noise
+ * @return the log likelihood ratios log( P( 0 ) / P( 1 ) ) of the
+ * received symbols, code_length per word
+ */
+vector< float > awgn_noise( const vector< uint > &message,
+                            uint code_length, float code_rate,
+                            float ebn0_db, uint64_t &noise_state );
+
+/*
+ * quantizes log likelihood ratios to 8 bits.
+ * @param llrs the log likelihood ratios
+ * @param step the ratio represented by one quantization level
+ * @return the quantized ratios, saturated to [ -127, 127 ]
+ */
+vector< int8_t > quantize_llrs( const vector< float > &llrs,
+                                float step );
+
 /*
 uint find_power( uint base, uint exponent )
 {
@@ -114,4 +166,132 @@ void burst_noise( vector< uint > &message, uint code_length,
   }
 }
 
+vector< uint > erasure_noise( vector< uint > &message,
+                              uint code_length,
+                              float erasure_probability )
+{
+  srand( time( NULL ) );
+
+  vector< uint > erasure_masks;
+  uint threshold = static_cast< uint >( erasure_probability * RAND_MAX );
+  for( uint i = 0; i < message.size(); i++ )
+  {
+    uint erasure_mask = 0;
+    for( uint place_value = 0; place_value < code_length; place_value++ )
+    {
+      if( static_cast< uint >( rand() ) < threshold )
+      {
+        erasure_mask |= 1u << place_value;
+      }
+    }
+    message.at( i ) &= ~erasure_mask;
+    erasure_masks.push_back( erasure_mask );
+  }
+  return erasure_masks;
+}
+
+void gaussian_noise( vector< float > &samples, float sigma,
+                     uint64_t seed )
+{
+  const uint LANES = 8;
+  const float TWO_PI = 6.2831853f;
+  const float UNIFORM_SCALE = 1.0f / 16777216.0f;
+
+  //seed each lane with a splitmix step, avoiding the zero state
+  uint32_t state[ LANES ];
+  for( uint lane = 0; lane < LANES; lane++ )
+  {
+    seed += 0x9E3779B97F4A7C15ULL;
+    uint64_t mixed = ( seed ^ ( seed >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    mixed = ( mixed ^ ( mixed >> 27 ) ) * 0x94D049BB133111EBULL;
+    state[ lane ] = static_cast< uint32_t >( mixed >> 32 ) | 1;
+  }
+
+  //each block turns two uniforms per lane into two normals per lane
+  float block[ 2 * LANES ];
+  for( size_t start = 0; start < samples.size(); start += 2 * LANES )
+  {
+    float radius[ LANES ];
+    float angle[ LANES ];
+    for( uint lane = 0; lane < LANES; lane++ )
+    {
+      uint32_t x = state[ lane ];
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      uint32_t y = x;
+      y ^= y << 13;
+      y ^= y >> 17;
+      y ^= y << 5;
+      state[ lane ] = y;
+
+      //uniforms in ( 0, 1 ] so the logarithm is finite
+      float first_uniform = ( ( x >> 8 ) + 1 ) * UNIFORM_SCALE;
+      float second_uniform = ( y >> 8 ) * UNIFORM_SCALE;
+      radius[ lane ] = sigma * sqrtf( -2.0f * logf( first_uniform ) );
+      angle[ lane ] = TWO_PI * second_uniform;
+    }
+    for( uint lane = 0; lane < LANES; lane++ )
+    {
+      block[ lane ] = radius[ lane ] * cosf( angle[ lane ] );
+      block[ lane + LANES ] = radius[ lane ] * sinf( angle[ lane ] );
+    }
+
+    size_t block_size = min( static_cast< size_t >( 2 * LANES ),
+                             samples.size() - start );
+    for( size_t i = 0; i < block_size; i++ )
+    {
+      samples[ start + i ] = block[ i ];
+    }
+  }
+}
+
+vector< float > awgn_noise( const vector< uint > &message,
+                            uint code_length, float code_rate,
+                            float ebn0_db, uint64_t &noise_state )
+{
+  //unit energy symbols, so N0 / 2 = 1 / ( 2 R Eb/N0 )
+  float ebn0 = powf( 10.0f, ebn0_db / 10.0f );
+  float variance = 1.0f / ( 2.0f * code_rate * ebn0 );
+  float llr_scale = 2.0f / variance;
+
+  vector< float > llrs( message.size() * code_length );
+  gaussian_noise( llrs, sqrtf( variance ), noise_state );
+
+  //step the state on by a 64 bit linear congruential generator, so
+  //the next frame is seeded differently
+  noise_state = noise_state * 6364136223846793005ULL
+    + 1442695040888963407ULL;
+
+  //add the symbols to the noise and scale to log likelihood ratios
+  for( size_t word = 0; word < message.size(); word++ )
+  {
+    uint this_word = message[ word ];
+    float *word_llrs = llrs.data() + word * code_length;
+    for( uint place_value = 0; place_value < code_length; place_value++ )
+    {
+      float symbol =
+        1.0f - 2.0f * static_cast< float >( ( this_word >> place_value ) & 1 );
+      word_llrs[ place_value ] =
+        ( symbol + word_llrs[ place_value ] ) * llr_scale;
+    }
+  }
+  return llrs;
+}
+
+vector< int8_t > quantize_llrs( const vector< float > &llrs,
+                                float step )
+{
+  float inverse_step = 1.0f / step;
+  vector< int8_t > quantized( llrs.size() );
+  for( size_t i = 0; i < llrs.size(); i++ )
+  {
+    float level = nearbyintf( llrs[ i ] * inverse_step );
+    level = level > 127.0f ? 127.0f : level;
+    level = level < -127.0f ? -127.0f : level;
+    quantized[ i ] = static_cast< int8_t >( level );
+  }
+  return quantized;
+}
+
 #endif
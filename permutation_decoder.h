@@ -0,0 +1,298 @@
+#ifndef PERMUTATION_DECODER_H
+#define PERMUTATION_DECODER_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include "cyclic_codes.h"
+
+using namespace std;
+
+/**
+ * A permutation decoder for a cyclic code. A binary cyclic code of
+ * odd length is fixed by the permutations i -> 2^j i + b mod n, the
+ * cyclic shifts composed with powers of the Frobenius map. The
+ * generator matrix is reduced to systematic form on an information
+ * set, and a PD-set of these permutations is chosen so that every
+ * error of weight at most t is moved off the information set by one
+ * of them. A received word is permuted by each in turn and
+ * re-encoded from its information places; once the difference has
+ * weight at most t, the errors were all in the check places, and
+ * the re-encoded word permuted back is the decoded word.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class PermutationDecoder
+{
+public:
+  /**
+   * Constructor specifying the code
+   * @param code the cyclic code to decode
+   */
+  PermutationDecoder( const CyclicCode &code );
+
+  /**
+   * Return the number of permutations in the PD-set
+   */
+  uint get_pd_set_size() const;
+
+  /**
+   * determine if every error of weight at most t is covered by the
+   * PD-set
+   */
+  bool is_complete() const;
+
+  /**
+   * decode the received word
+   * @param received_word the word to be decoded
+   * @return the decoded word, from the code's own decoder if no
+   * permutation in the PD-set moves the errors off the information
+   * set
+   */
+  uint decode_word( uint received_word ) const;
+
+private:
+
+  /**
+   * move bit i of a word to bit a i + b mod n
+   * @param word the word to be permuted
+   * @param multiplier the index j of the multiplier a = 2^j
+   * @param shift the shift b
+   * @return the permuted word
+   */
+  uint permute( uint word, uint multiplier, uint shift ) const;
+
+  /**
+   * undo the permutation i -> a i + b mod n
+   * @param word the permuted word
+   * @param multiplier the index j of the multiplier a = 2^j
+   * @param shift the shift b
+   * @return the original word
+   */
+  uint unpermute( uint word, uint multiplier, uint shift ) const;
+
+  /**
+   * re-encode a word from its information places
+   * @param word the word
+   * @return the code word agreeing with it on the information set
+   */
+  uint reencode( uint word ) const;
+
+  const CyclicCode &code;
+  vector< uint > systematic_rows;
+  vector< uint > information_places;
+  vector< uint > multiplier_tables;
+  vector< uint > pd_multipliers;
+  vector< uint > pd_shifts;
+  uint num_multipliers;
+  uint information_set;
+  uint code_length;
+  uint word_mask;
+  uint correctable_weight;
+  bool complete;
+};
+
+PermutationDecoder::PermutationDecoder( const CyclicCode &param_code )
+: code( param_code ), information_set( 0 ),
+  code_length( param_code.get_code_length() ), complete( true )
+{
+  word_mask = code_length < 32 ? ( 1u << code_length ) - 1 : UINT_MAX;
+  correctable_weight = ( code.get_min_distance() - 1 ) / 2;
+
+  //reduce the generator matrix to systematic form, each row the
+  //only one with a 1 in its information place
+  systematic_rows = code.get_generator();
+  for( uint row = 0; row < systematic_rows.size(); row++ )
+  {
+    uint pivot = systematic_rows.at( row ) &
+      -systematic_rows.at( row );
+    for( uint other = 0; other < systematic_rows.size(); other++ )
+    {
+      if( other != row && ( systematic_rows.at( other ) & pivot ) != 0 )
+      {
+        systematic_rows.at( other ) ^= systematic_rows.at( row );
+      }
+    }
+    information_places.push_back( __builtin_ctz( pivot ) );
+    information_set |= pivot;
+  }
+
+  //the multipliers 2^j mod n; for even n only the identity, since
+  //then 2 has no inverse mod n
+  num_multipliers = 1;
+  if( code_length % 2 == 1 )
+  {
+    uint power = 2 % code_length;
+    while( power != 1 )
+    {
+      power = ( power * 2 ) % code_length;
+      num_multipliers++;
+    }
+  }
+
+  //byte tables for each multiplier, so a word is permuted with
+  //four lookups
+  multiplier_tables.assign( num_multipliers * 4 * 256, 0 );
+  uint multiplier_value = 1;
+  for( uint multiplier = 0; multiplier < num_multipliers; multiplier++ )
+  {
+    for( uint place_value = 0; place_value < code_length; place_value++ )
+    {
+      uint image = ( multiplier_value * place_value ) % code_length;
+      uint byte = place_value / 8;
+      for( uint value = 0; value < 256; value++ )
+      {
+        if( ( ( value >> ( place_value % 8 ) ) & 1 ) == 1 )
+        {
+          multiplier_tables.at( ( multiplier * 4 + byte ) * 256 + value ) |=
+            1u << image;
+        }
+      }
+    }
+    multiplier_value = ( multiplier_value * 2 ) % code_length;
+  }
+
+  //list every error of weight at most t, walking each weight by
+  //Gosper's method rather than testing all 2^n words
+  vector< uint > errors;
+  uint64_t word_limit = uint64_t( 1 ) << code_length;
+  for( uint weight = 1; weight <= correctable_weight; weight++ )
+  {
+    for( uint64_t error = ( uint64_t( 1 ) << weight ) - 1;
+         error < word_limit; )
+    {
+      errors.push_back( uint( error ) );
+      uint64_t lowest = error & -error;
+      uint64_t ripple = error + lowest;
+      error = ( ( ( ripple ^ error ) >> 2 ) / lowest ) | ripple;
+    }
+  }
+
+  //greedily choose the permutation moving the most uncovered errors
+  //off the information set until every error is covered
+  vector< bool > covered( errors.size(), false );
+  uint num_uncovered = errors.size();
+  while( num_uncovered > 0 )
+  {
+    uint best_count = 0;
+    uint best_multiplier = 0;
+    uint best_shift = 0;
+    for( uint multiplier = 0; multiplier < num_multipliers; multiplier++ )
+    {
+      for( uint shift = 0; shift < code_length; shift++ )
+      {
+        uint count = 0;
+        for( uint i = 0; i < errors.size(); i++ )
+        {
+          if( !covered.at( i ) &&
+              ( permute( errors.at( i ), multiplier, shift )
+                & information_set ) == 0 )
+          {
+            count++;
+          }
+        }
+        if( count > best_count )
+        {
+          best_count = count;
+          best_multiplier = multiplier;
+          best_shift = shift;
+        }
+      }
+    }
+
+    if( best_count == 0 )
+    {
+      complete = false;
+      break;
+    }
+    for( uint i = 0; i < errors.size(); i++ )
+    {
+      if( !covered.at( i ) &&
+          ( permute( errors.at( i ), best_multiplier, best_shift )
+            & information_set ) == 0 )
+      {
+        covered.at( i ) = true;
+        num_uncovered--;
+      }
+    }
+    pd_multipliers.push_back( best_multiplier );
+    pd_shifts.push_back( best_shift );
+  }
+}
+
+uint PermutationDecoder::get_pd_set_size() const
+{
+  return pd_shifts.size();
+}
+
+bool PermutationDecoder::is_complete() const
+{
+  return complete;
+}
+
+uint PermutationDecoder::decode_word( uint received_word ) const
+{
+  //the identity is always worth trying first
+  uint candidate = reencode( received_word );
+  if( static_cast< uint >( __builtin_popcount( candidate ^ received_word ) )
+      <= correctable_weight )
+  {
+    return candidate;
+  }
+
+  for( uint i = 0; i < pd_shifts.size(); i++ )
+  {
+    uint permuted_word = permute( received_word, pd_multipliers.at( i ),
+                                  pd_shifts.at( i ) );
+    candidate = reencode( permuted_word );
+    if( static_cast< uint >( __builtin_popcount( candidate ^ permuted_word ) )
+        <= correctable_weight )
+    {
+      return unpermute( candidate, pd_multipliers.at( i ),
+                        pd_shifts.at( i ) );
+    }
+  }
+  return code.decode_word( received_word );
+}
+
+uint PermutationDecoder::permute( uint word, uint multiplier,
+                                  uint shift ) const
+{
+  const uint *table = multiplier_tables.data() + multiplier * 4 * 256;
+  uint multiplied = table[ word & 0xFF ] |
+    table[ 256 + ( ( word >> 8 ) & 0xFF ) ] |
+    table[ 512 + ( ( word >> 16 ) & 0xFF ) ] |
+    table[ 768 + ( word >> 24 ) ];
+  if( shift == 0 )
+  {
+    return multiplied;
+  }
+  return ( ( multiplied << shift ) | ( multiplied >> ( code_length - shift ) ) )
+    & word_mask;
+}
+
+uint PermutationDecoder::unpermute( uint word, uint multiplier,
+                                    uint shift ) const
+{
+  //shift back by b, then multiply by a^-1 = 2^( m - j )
+  uint back_shift = ( code_length - shift ) % code_length;
+  uint shifted = permute( word, 0, back_shift );
+  return permute( shifted, ( num_multipliers - multiplier ) % num_multipliers,
+                  0 );
+}
+
+uint PermutationDecoder::reencode( uint word ) const
+{
+  uint code_word = 0;
+  for( uint row = 0; row < systematic_rows.size(); row++ )
+  {
+    if( ( ( word >> information_places.at( row ) ) & 1 ) == 1 )
+    {
+      code_word ^= systematic_rows.at( row );
+    }
+  }
+  return code_word;
+}
+
+#endif
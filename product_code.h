@@ -0,0 +1,368 @@
+#ifndef PRODUCT_CODE_H
+#define PRODUCT_CODE_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include <thread>
+#include "cyclic_codes.h"
+#include "reed_solomon.h"
+
+using namespace std;
+
+/**
+ * Transpose a 32 by 32 bit block in place, so bit c of word r moves
+ * to bit r of word c. Each of the five rounds swaps the off-diagonal
+ * quarters of every block of twice the previous size, so the whole
+ * block is transposed in 32 log 32 word operations instead of 1024
+ * single bit moves.
+ * @param block the 32 words of the block
+ */
+void transpose_block( uint *block )
+{
+  uint mask = 0x0000FFFF;
+  for( uint j = 16; j != 0; j = j >> 1, mask ^= mask << j )
+  {
+    for( uint k = 0; k < 32; k = ( k + j + 1 ) & ~j )
+    {
+      uint swapped = ( ( block[ k ] >> j ) ^ block[ k + j ] ) & mask;
+      block[ k ] ^= swapped << j;
+      block[ k + j ] ^= swapped;
+    }
+  }
+}
+
+/**
+ * A product code of two cyclic codes. A block is n2 rows of n1 bits;
+ * every row is a code word of the row code and every column a code
+ * word of the column code. Decoding alternates between decoding all
+ * the rows and all the columns until a pass changes nothing, with
+ * the block transposed between passes so both are batches of words.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class ProductCode
+{
+public:
+  /**
+   * Constructor specifying the component codes
+   * @param row_code the code of each row
+   * @param column_code the code of each column
+   * @param max_iterations the number of row and column passes allowed
+   */
+  ProductCode( const CyclicCode &row_code, const CyclicCode &column_code,
+               uint max_iterations );
+
+  /**
+   * Return the number of bits in a block
+   */
+  uint get_code_length() const;
+
+  /**
+   * Return the number of message bits in a block
+   */
+  uint get_dimension() const;
+
+  /**
+   * encode a message
+   * @param message k2 words of k1 bits
+   * @return the n2 rows of the block
+   */
+  vector< uint > encode_block( const vector< uint > &message ) const;
+
+  /**
+   * recover the message from a block of code words
+   * @param block the n2 rows of the block
+   * @return the k2 words of k1 bits
+   */
+  vector< uint > extract_message( const vector< uint > &block ) const;
+
+  /**
+   * decode a received block
+   * @param received_block the n2 rows of the block
+   * @return the decoded block
+   */
+  vector< uint > decode_block( vector< uint > received_block ) const;
+
+  /**
+   * decode many blocks stored one after another. Each thread takes a
+   * share of the blocks and decodes the rows of all of its blocks as
+   * one batch, then all of their columns
+   * @param received_blocks the rows of every block
+   * @param num_threads the number of threads to decode with
+   * @return the decoded blocks
+   */
+  vector< uint > decode_batch( const vector< uint > &received_blocks,
+                               uint num_threads ) const;
+
+private:
+
+  /**
+   * decode blocks stored one after another, passing over the rows of
+   * every block still changing in one batch and then their columns
+   * @param received_blocks the rows of the first block
+   * @param num_blocks the number of blocks
+   * @param decoded_blocks set to the rows of the decoded blocks
+   */
+  void decode_blocks( const uint *received_blocks, uint num_blocks,
+                      uint *decoded_blocks ) const;
+
+  /**
+   * transpose a block of up to 32 words
+   * @param words the words, each num_places bits
+   * @param num_places the number of bits in each word
+   * @return num_places words, each words.size() bits
+   */
+  static vector< uint > transpose( const vector< uint > &words,
+                                   uint num_places );
+
+  const CyclicCode &row_code;
+  const CyclicCode &column_code;
+  uint max_iterations;
+  uint row_length;
+  uint column_length;
+  uint row_dimension;
+  uint column_dimension;
+};
+
+ProductCode::ProductCode( const CyclicCode &param_row_code,
+                          const CyclicCode &param_column_code,
+                          uint param_max_iterations )
+: row_code( param_row_code ), column_code( param_column_code ),
+  max_iterations( param_max_iterations ),
+  row_length( param_row_code.get_code_length() ),
+  column_length( param_column_code.get_code_length() ),
+  row_dimension( param_row_code.get_generator().size() ),
+  column_dimension( param_column_code.get_generator().size() )
+{
+}
+
+uint ProductCode::get_code_length() const
+{
+  return row_length * column_length;
+}
+
+uint ProductCode::get_dimension() const
+{
+  return row_dimension * column_dimension;
+}
+
+vector< uint > ProductCode::encode_block(
+  const vector< uint > &message ) const
+{
+  //encode the k2 message rows, then each of the n1 columns
+  vector< uint > rows( column_dimension );
+  for( uint row = 0; row < column_dimension; row++ )
+  {
+    rows.at( row ) = row_code.encode_word( message.at( row ) );
+  }
+  vector< uint > columns = transpose( rows, row_length );
+  for( uint &column : columns )
+  {
+    column = column_code.encode_word( column );
+  }
+  return transpose( columns, column_length );
+}
+
+vector< uint > ProductCode::extract_message(
+  const vector< uint > &block ) const
+{
+  vector< uint > columns = transpose( block, row_length );
+  for( uint &column : columns )
+  {
+    column = column_code.extract_message( column );
+  }
+  vector< uint > rows = transpose( columns, column_dimension );
+  for( uint &row : rows )
+  {
+    row = row_code.extract_message( row );
+  }
+  return rows;
+}
+
+vector< uint > ProductCode::decode_block(
+  vector< uint > received_block ) const
+{
+  vector< uint > decoded_block( column_length );
+  decode_blocks( received_block.data(), 1, decoded_block.data() );
+  return decoded_block;
+}
+
+vector< uint > ProductCode::decode_batch(
+  const vector< uint > &received_blocks, uint num_threads ) const
+{
+  //blocks are independent, so each thread takes a contiguous share
+  uint num_blocks = received_blocks.size() / column_length;
+  num_threads = num_threads > 0 ? num_threads : 1;
+  num_threads = num_threads < num_blocks ? num_threads : num_blocks;
+  vector< uint > decoded_blocks( received_blocks.size() );
+  vector< thread > threads;
+  for( uint t = 0; t < num_threads; t++ )
+  {
+    uint first = num_blocks * t / num_threads;
+    uint last = num_blocks * ( t + 1 ) / num_threads;
+    threads.push_back( thread( [ this, &received_blocks, &decoded_blocks,
+                                 first, last ]()
+    {
+      decode_blocks( received_blocks.data() + first * column_length,
+                     last - first,
+                     decoded_blocks.data() + first * column_length );
+    } ) );
+  }
+  for( thread &worker : threads )
+  {
+    worker.join();
+  }
+  return decoded_blocks;
+}
+
+void ProductCode::decode_blocks( const uint *received_blocks,
+                                 uint num_blocks,
+                                 uint *decoded_blocks ) const
+{
+  copy( received_blocks, received_blocks + num_blocks * column_length,
+        decoded_blocks );
+
+  //the blocks still changing; a block that a pass leaves unchanged
+  //has converged and drops out of the batches
+  vector< uint > active_blocks( num_blocks );
+  for( uint block = 0; block < num_blocks; block++ )
+  {
+    active_blocks.at( block ) = block;
+  }
+  vector< uint > rows;
+  vector< uint > columns;
+  for( uint iteration = 0;
+       iteration < max_iterations && !active_blocks.empty(); iteration++ )
+  {
+    //decode the rows of every active block as one batch
+    rows.clear();
+    for( uint block : active_blocks )
+    {
+      const uint *first_row = decoded_blocks + block * column_length;
+      rows.insert( rows.end(), first_row, first_row + column_length );
+    }
+    rows = row_code.decode_batch( rows );
+
+    //then the columns of every active block as another, each block
+    //transposed in place on the stack
+    columns.clear();
+    for( uint i = 0; i < active_blocks.size(); i++ )
+    {
+      uint block[ 32 ] = { 0 };
+      copy( rows.begin() + i * column_length,
+            rows.begin() + ( i + 1 ) * column_length, block );
+      transpose_block( block );
+      columns.insert( columns.end(), block, block + row_length );
+    }
+    columns = column_code.decode_batch( columns );
+
+    uint num_active = 0;
+    for( uint i = 0; i < active_blocks.size(); i++ )
+    {
+      uint block[ 32 ] = { 0 };
+      copy( columns.begin() + i * row_length,
+            columns.begin() + ( i + 1 ) * row_length, block );
+      transpose_block( block );
+      uint *decoded_block =
+        decoded_blocks + active_blocks.at( i ) * column_length;
+      if( !equal( block, block + column_length, decoded_block ) )
+      {
+        copy( block, block + column_length, decoded_block );
+        active_blocks.at( num_active ) = active_blocks.at( i );
+        num_active++;
+      }
+    }
+    active_blocks.resize( num_active );
+  }
+}
+
+vector< uint > ProductCode::transpose( const vector< uint > &words,
+                                       uint num_places )
+{
+  uint block[ 32 ] = { 0 };
+  for( uint i = 0; i < words.size(); i++ )
+  {
+    block[ i ] = words[ i ];
+  }
+  transpose_block( block );
+  return vector< uint >( block, block + num_places );
+}
+
+/**
+ * A concatenated code with a Reed-Solomon outer code and a cyclic
+ * inner code. Each m bit symbol of an outer code word is the message
+ * of one inner code word, so the inner code must have dimension at
+ * least m. The inner words are decoded as one batch, their messages
+ * taken as the received symbols, and the outer decoder corrects the
+ * symbols the inner decoder got wrong.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class ConcatenatedCode
+{
+public:
+  /**
+   * Constructor specifying the component codes
+   * @param outer_code the Reed-Solomon code over the symbols
+   * @param inner_code the cyclic code carrying each symbol
+   */
+  ConcatenatedCode( const ReedSolomonCode &outer_code,
+                    const CyclicCode &inner_code );
+
+  /**
+   * encode a message
+   * @param message the K outer message symbols
+   * @return the N inner code words
+   */
+  vector< uint > encode_word( const vector< uint > &message ) const;
+
+  /**
+   * decode the received inner words to the message
+   * @param received_words the N received inner words
+   * @return the K message symbols
+   */
+  vector< uint > decode_word( const vector< uint > &received_words ) const;
+
+private:
+  const ReedSolomonCode &outer_code;
+  const CyclicCode &inner_code;
+  uint symbol_mask;
+};
+
+ConcatenatedCode::ConcatenatedCode( const ReedSolomonCode &param_outer_code,
+                                    const CyclicCode &param_inner_code )
+: outer_code( param_outer_code ), inner_code( param_inner_code )
+{
+  symbol_mask = ( 1u << outer_code.get_symbol_bits() ) - 1;
+  if( inner_code.get_generator().size() < outer_code.get_symbol_bits() )
+  {
+    cout << "the inner code cannot carry a whole symbol." << endl;
+  }
+}
+
+vector< uint > ConcatenatedCode::encode_word(
+  const vector< uint > &message ) const
+{
+  vector< uint > symbols = outer_code.encode_word( message );
+  for( uint &symbol : symbols )
+  {
+    symbol = inner_code.encode_word( symbol );
+  }
+  return symbols;
+}
+
+vector< uint > ConcatenatedCode::decode_word(
+  const vector< uint > &received_words ) const
+{
+  vector< uint > symbols = inner_code.decode_batch( received_words );
+  for( uint &symbol : symbols )
+  {
+    symbol = inner_code.extract_message( symbol ) & symbol_mask;
+  }
+  return outer_code.extract_message( outer_code.decode_word( symbols ) );
+}
+
+#endif
@@ -0,0 +1,455 @@
+#ifndef QR_CODE_H
+#define QR_CODE_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+
+using namespace std;
+
+/**
+ * A binary quadratic residue code of prime length n = +-1 mod 8.
+ * Since 2 is then a quadratic residue mod n, the residues are a
+ * union of cyclotomic cosets, and g(x), the product of x - beta^r
+ * over the residues r for a primitive n-th root of unity beta in
+ * GF( 2^m ), is the product of the minimal polynomials of those
+ * cosets and has binary coefficients. The code has dimension
+ * ( n + 1 ) / 2 and is decoded with a table of the syndromes of
+ * every error of weight at most t.
+ *
+ * Words are held in a uint64_t, bit i the coefficient of x^i, so
+ * n is at most 63.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class QuadraticResidueCode
+{
+public:
+  /**
+   * Constructor specifying the length
+   * @param code_length a prime n = +-1 mod 8, at most 63
+   */
+  QuadraticResidueCode( uint code_length );
+
+  /**
+   * Return the code length n
+   */
+  uint get_code_length() const;
+
+  /**
+   * Return the dimension k of the code
+   */
+  uint get_dimension() const;
+
+  /**
+   * Return the minimum distance of the code
+   */
+  uint get_min_distance() const;
+
+  /**
+   * Return the generator polynomial g(x)
+   */
+  uint64_t get_generator_polynomial() const;
+
+  /**
+   * Print the parameters of the code
+   */
+  void print_parameters() const;
+
+  /**
+   * encode the word systematically, so that the message occupies
+   * the k highest places of the code word.
+   * @param word the k bit message
+   * @return the n bit code word
+   */
+  uint64_t encode_word( uint64_t word ) const;
+
+  /**
+   * extract the message from a systematic code word
+   * @param code_word the code word
+   * @return the message
+   */
+  uint64_t extract_message( uint64_t code_word ) const;
+
+  /**
+   * compute the syndrome r(x) mod g(x) of a received word
+   * @param word the received word
+   * @return the syndrome
+   */
+  uint64_t get_syndrome( uint64_t word ) const;
+
+  /**
+   * determine if the word is part of the code
+   * @param word the word to be checked
+   * @return if it is a word or not
+   */
+  bool is_code_word( uint64_t word ) const;
+
+  /**
+   * decode the received word with the syndrome table
+   * @param received_word the word to be decoded
+   * @return the corrected word, or the received word if its
+   * syndrome is not that of an error of weight at most t
+   */
+  uint64_t decode_word( uint64_t received_word ) const;
+
+private:
+
+  /**
+   * multiply two elements of GF( 2^m )
+   * @param first the first element
+   * @param second the second element
+   * @return the product mod the field polynomial
+   */
+  uint64_t field_product( uint64_t first, uint64_t second ) const;
+
+  /**
+   * raise an element of GF( 2^m ) to a power
+   * @param base the element
+   * @param exponent the power
+   * @return the result
+   */
+  uint64_t field_power( uint64_t base, uint64_t exponent ) const;
+
+  /**
+   * determine the minimal polynomial of beta^r, the product of
+   * x - beta^( r 2^j ) over the cyclotomic coset of r
+   * @param root the element beta
+   * @param representative r
+   * @return the minimal polynomial, bit i the coefficient of x^i
+   */
+  uint64_t minimal_polynomial( uint64_t root, uint representative ) const;
+
+  /**
+   * determine if a polynomial is irreducible by trial division
+   * @param polynomial the polynomial
+   * @return whether it is irreducible
+   */
+  static bool is_irreducible( uint64_t polynomial );
+
+  /**
+   * find the minimum distance by a Gray code walk over the code
+   */
+  void find_min_distance();
+
+  /**
+   * fill the syndrome table with every error of weight at most t,
+   * lightest first
+   */
+  void build_syndrome_table();
+
+  uint code_length;
+  uint dimension;
+  uint min_distance;
+  uint field_degree;
+  uint64_t field_polynomial;
+  uint64_t generator_polynomial;
+  vector< uint64_t > column_syndromes;
+  vector< uint64_t > syndrome_table;
+};
+
+QuadraticResidueCode::QuadraticResidueCode( uint param_code_length )
+: code_length( param_code_length ), dimension( 0 ), min_distance( 0 ),
+  field_degree( 0 ), field_polynomial( 0 ), generator_polynomial( 1 )
+{
+  bool is_prime = code_length > 2;
+  for( uint divisor = 2; divisor * divisor <= code_length; divisor++ )
+  {
+    is_prime = is_prime && code_length % divisor != 0;
+  }
+  if( !is_prime || code_length > 63 ||
+      ( code_length % 8 != 1 && code_length % 8 != 7 ) )
+  {
+    cout << "no binary quadratic residue code of length "
+         << code_length << "." << endl;
+    code_length = 0;
+    return;
+  }
+
+  //GF( 2^m ) holds the n-th roots of unity for m the order of 2 mod n
+  field_degree = 1;
+  uint power = 2 % code_length;
+  while( power != 1 )
+  {
+    power = ( power * 2 ) % code_length;
+    field_degree++;
+  }
+  for( uint64_t polynomial = ( 1ULL << field_degree ) + 1;
+       field_polynomial == 0; polynomial += 2 )
+  {
+    if( is_irreducible( polynomial ) )
+    {
+      field_polynomial = polynomial;
+    }
+  }
+
+  //beta = gamma^( ( 2^m - 1 ) / n ) has order n unless it is 1
+  uint64_t group_order = ( 1ULL << field_degree ) - 1;
+  uint64_t root = 1;
+  for( uint64_t gamma = 2; root == 1; gamma++ )
+  {
+    root = field_power( gamma, group_order / code_length );
+  }
+
+  //g(x) is the product of the minimal polynomials of the cosets
+  //of quadratic residues
+  vector< bool > residue( code_length, false );
+  for( uint i = 1; i < code_length; i++ )
+  {
+    residue.at( ( i * i ) % code_length ) = true;
+  }
+  vector< bool > used( code_length, false );
+  for( uint representative = 1; representative < code_length;
+       representative++ )
+  {
+    if( !residue.at( representative ) || used.at( representative ) )
+    {
+      continue;
+    }
+    uint member = representative;
+    do
+    {
+      used.at( member ) = true;
+      member = ( member * 2 ) % code_length;
+    } while( member != representative );
+
+    uint64_t factor = minimal_polynomial( root, representative );
+    uint64_t product = 0;
+    for( uint place_value = 0; place_value < 64; place_value++ )
+    {
+      if( ( ( factor >> place_value ) & 1 ) == 1 )
+      {
+        product ^= generator_polynomial << place_value;
+      }
+    }
+    generator_polynomial = product;
+  }
+
+  dimension = ( code_length + 1 ) / 2;
+
+  //column i of the syndrome map is x^i mod g(x)
+  uint redundancy = code_length - dimension;
+  uint64_t column = 1;
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    column_syndromes.push_back( column );
+    column = column << 1;
+    if( ( ( column >> redundancy ) & 1 ) == 1 )
+    {
+      column ^= generator_polynomial;
+    }
+  }
+
+  find_min_distance();
+  build_syndrome_table();
+}
+
+uint QuadraticResidueCode::get_code_length() const
+{
+  return code_length;
+}
+
+uint QuadraticResidueCode::get_dimension() const
+{
+  return dimension;
+}
+
+uint QuadraticResidueCode::get_min_distance() const
+{
+  return min_distance;
+}
+
+uint64_t QuadraticResidueCode::get_generator_polynomial() const
+{
+  return generator_polynomial;
+}
+
+void QuadraticResidueCode::print_parameters() const
+{
+  cout << "quadratic residue code" << endl;
+  cout << "field: GF( 2^" << field_degree << " ) mod "
+       << field_polynomial << endl;
+  cout << "generator: " << generator_polynomial << endl;
+  cout << "( n, k, d ): ( " << code_length << ", " << dimension << ", "
+       << min_distance << " )" << endl;
+  cout << endl;
+}
+
+uint64_t QuadraticResidueCode::encode_word( uint64_t word ) const
+{
+  uint redundancy = code_length - dimension;
+  uint64_t shifted_message =
+    ( word & ( ( 1ULL << dimension ) - 1 ) ) << redundancy;
+  return shifted_message | get_syndrome( shifted_message );
+}
+
+uint64_t QuadraticResidueCode::extract_message( uint64_t code_word ) const
+{
+  return code_word >> ( code_length - dimension );
+}
+
+uint64_t QuadraticResidueCode::get_syndrome( uint64_t word ) const
+{
+  uint64_t syndrome = 0;
+  while( word != 0 )
+  {
+    syndrome ^= column_syndromes.at( __builtin_ctzll( word ) );
+    word &= word - 1;
+  }
+  return syndrome;
+}
+
+bool QuadraticResidueCode::is_code_word( uint64_t word ) const
+{
+  return get_syndrome( word ) == 0;
+}
+
+uint64_t QuadraticResidueCode::decode_word( uint64_t received_word ) const
+{
+  uint64_t syndrome = get_syndrome( received_word );
+  if( syndrome == 0 || syndrome_table.empty() )
+  {
+    return received_word;
+  }
+  return received_word ^ syndrome_table.at( syndrome );
+}
+
+uint64_t QuadraticResidueCode::field_product( uint64_t first,
+                                              uint64_t second ) const
+{
+  uint64_t product = 0;
+  uint64_t top_bit = 1ULL << field_degree;
+  while( second != 0 )
+  {
+    if( ( second & 1 ) == 1 )
+    {
+      product ^= first;
+    }
+    second = second >> 1;
+    first = first << 1;
+    if( ( first & top_bit ) != 0 )
+    {
+      first ^= field_polynomial;
+    }
+  }
+  return product;
+}
+
+uint64_t QuadraticResidueCode::field_power( uint64_t base,
+                                            uint64_t exponent ) const
+{
+  uint64_t result = 1;
+  while( exponent != 0 )
+  {
+    if( ( exponent & 1 ) == 1 )
+    {
+      result = field_product( result, base );
+    }
+    base = field_product( base, base );
+    exponent = exponent >> 1;
+  }
+  return result;
+}
+
+uint64_t QuadraticResidueCode::minimal_polynomial(
+  uint64_t root, uint representative ) const
+{
+  //multiply out the factors with coefficients in GF( 2^m ), lowest
+  //degree first; the result has coefficients 0 and 1
+  vector< uint64_t > coefficients = { 1 };
+  uint member = representative;
+  do
+  {
+    uint64_t conjugate = field_power( root, member );
+    coefficients.push_back( 0 );
+    for( uint i = coefficients.size() - 1; i > 0; i-- )
+    {
+      coefficients.at( i ) = coefficients.at( i - 1 ) ^
+        field_product( coefficients.at( i ), conjugate );
+    }
+    coefficients.at( 0 ) = field_product( coefficients.at( 0 ), conjugate );
+    member = ( member * 2 ) % code_length;
+  } while( member != representative );
+
+  uint64_t polynomial = 0;
+  for( uint i = 0; i < coefficients.size(); i++ )
+  {
+    if( coefficients.at( i ) > 1 )
+    {
+      cout << "minimal polynomial is not binary." << endl;
+    }
+    polynomial |= ( coefficients.at( i ) & 1 ) << i;
+  }
+  return polynomial;
+}
+
+bool QuadraticResidueCode::is_irreducible( uint64_t polynomial )
+{
+  uint degree = 63 - __builtin_clzll( polynomial );
+  for( uint64_t divisor = 2; divisor < ( 1ULL << ( degree / 2 + 1 ) );
+       divisor++ )
+  {
+    //remainder of the polynomial divided by the divisor
+    uint divisor_degree = 63 - __builtin_clzll( divisor );
+    uint64_t remainder = polynomial;
+    for( uint place_value = degree; place_value != UINT_MAX &&
+           place_value >= divisor_degree; place_value-- )
+    {
+      if( ( ( remainder >> place_value ) & 1 ) == 1 )
+      {
+        remainder ^= divisor << ( place_value - divisor_degree );
+      }
+    }
+    if( remainder == 0 )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void QuadraticResidueCode::find_min_distance()
+{
+  //step through every code word, changing one row x^i g(x) each step
+  min_distance = code_length;
+  uint64_t code_word = 0;
+  for( uint64_t step = 1; step < ( 1ULL << dimension ); step++ )
+  {
+    code_word ^= generator_polynomial << __builtin_ctzll( step );
+    uint weight = __builtin_popcountll( code_word );
+    min_distance = weight < min_distance ? weight : min_distance;
+  }
+}
+
+void QuadraticResidueCode::build_syndrome_table()
+{
+  uint redundancy = code_length - dimension;
+  if( redundancy > 24 )
+  {
+    cout << "the syndrome table is limited to 2^24 entries." << endl;
+    return;
+  }
+  syndrome_table.assign( 1ULL << redundancy, 0 );
+
+  //errors of weight w are walked in increasing order by Gosper's
+  //method; the first error to reach a syndrome is the lightest
+  uint correctable_weight = ( min_distance - 1 ) / 2;
+  uint64_t word_limit = 1ULL << code_length;
+  for( uint weight = 1; weight <= correctable_weight; weight++ )
+  {
+    for( uint64_t error = ( 1ULL << weight ) - 1; error < word_limit; )
+    {
+      uint64_t syndrome = get_syndrome( error );
+      if( syndrome_table.at( syndrome ) == 0 )
+      {
+        syndrome_table.at( syndrome ) = error;
+      }
+      uint64_t lowest = error & -error;
+      uint64_t ripple = error + lowest;
+      error = ( ( ( ripple ^ error ) >> 2 ) / lowest ) | ripple;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,358 @@
+#ifndef REED_SOLOMON_H
+#define REED_SOLOMON_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+
+using namespace std;
+
+/**
+ * A Reed-Solomon code over GF( 2^m ), 3 <= m <= 8, of length
+ * N <= 2^m - 1 symbols and dimension K, shortened when N < 2^m - 1.
+ * The generator has roots alpha, ..., alpha^( N - K ), encoding is
+ * systematic with the message in the K highest places, and decoding
+ * corrects ( N - K ) / 2 symbol errors with the Berlekamp-Massey
+ * algorithm, a Chien search and Forney's formula.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class ReedSolomonCode
+{
+public:
+  /**
+   * Constructor specifying the field and the code size
+   * @param symbol_bits m, the bits per symbol
+   * @param num_symbols N, the length in symbols
+   * @param message_symbols K, the dimension in symbols
+   */
+  ReedSolomonCode( uint symbol_bits, uint num_symbols,
+                   uint message_symbols );
+
+  /**
+   * Return the bits per symbol
+   */
+  uint get_symbol_bits() const;
+
+  /**
+   * Return the length in symbols
+   */
+  uint get_code_length() const;
+
+  /**
+   * Return the dimension in symbols
+   */
+  uint get_dimension() const;
+
+  /**
+   * encode a message
+   * @param message the K message symbols
+   * @return the N code word symbols, symbol i the coefficient of x^i
+   */
+  vector< uint > encode_word( vector< uint > message ) const;
+
+  /**
+   * extract the message from a systematic code word
+   * @param code_word the code word
+   * @return the message
+   */
+  vector< uint > extract_message( vector< uint > code_word ) const;
+
+  /**
+   * correct symbol errors in place
+   * @param word the received word
+   * @return whether the word is now a code word
+   */
+  bool correct_errors( vector< uint > &word ) const;
+
+  /**
+   * decode the received word
+   * @param received_word the received word
+   * @return the corrected word, or the received word if there were
+   * more errors than could be corrected
+   */
+  vector< uint > decode_word( vector< uint > received_word ) const;
+
+private:
+
+  /**
+   * multiply two field elements
+   */
+  uint field_product( uint first, uint second ) const;
+
+  /**
+   * divide two field elements, the divisor nonzero
+   */
+  uint field_quotient( uint dividend, uint divisor ) const;
+
+  /**
+   * evaluate a polynomial with symbol coefficients at a field element
+   * @param polynomial the coefficients, lowest degree first
+   * @param point the element
+   * @return the value
+   */
+  uint evaluate( const vector< uint > &polynomial, uint point ) const;
+
+  uint symbol_bits;
+  uint field_size;
+  uint code_length;
+  uint dimension;
+  vector< uint > exponentials;
+  vector< uint > logarithms;
+  vector< uint > generator_polynomial;
+};
+
+ReedSolomonCode::ReedSolomonCode( uint param_symbol_bits,
+                                  uint num_symbols, uint message_symbols )
+: symbol_bits( param_symbol_bits ), code_length( num_symbols ),
+  dimension( message_symbols )
+{
+  //a primitive polynomial for each field size
+  const uint PRIMITIVE_POLYNOMIALS[ 9 ] =
+    { 0, 0, 0, 0xB, 0x13, 0x25, 0x43, 0x89, 0x11D };
+  if( symbol_bits < 3 || symbol_bits > 8 )
+  {
+    cout << "symbols must have 3 to 8 bits." << endl;
+    symbol_bits = 8;
+  }
+  field_size = 1u << symbol_bits;
+  if( code_length > field_size - 1 || dimension >= code_length )
+  {
+    cout << "no Reed-Solomon code with these parameters." << endl;
+  }
+
+  //tables of alpha^i and log_alpha, doubled to skip a reduction
+  exponentials.assign( 2 * field_size, 0 );
+  logarithms.assign( field_size, 0 );
+  uint element = 1;
+  for( uint i = 0; i < field_size - 1; i++ )
+  {
+    exponentials.at( i ) = element;
+    exponentials.at( i + field_size - 1 ) = element;
+    logarithms.at( element ) = i;
+    element = element << 1;
+    if( element >= field_size )
+    {
+      element ^= PRIMITIVE_POLYNOMIALS[ symbol_bits ];
+    }
+  }
+
+  //g(x) = ( x - alpha )( x - alpha^2 ) ... ( x - alpha^( N - K ) )
+  generator_polynomial = { 1 };
+  for( uint root = 1; root <= code_length - dimension; root++ )
+  {
+    generator_polynomial.push_back( 0 );
+    for( uint i = generator_polynomial.size() - 1; i > 0; i-- )
+    {
+      generator_polynomial.at( i ) = generator_polynomial.at( i - 1 ) ^
+        field_product( generator_polynomial.at( i ),
+                       exponentials.at( root ) );
+    }
+    generator_polynomial.at( 0 ) =
+      field_product( generator_polynomial.at( 0 ), exponentials.at( root ) );
+  }
+}
+
+uint ReedSolomonCode::get_symbol_bits() const
+{
+  return symbol_bits;
+}
+
+uint ReedSolomonCode::get_code_length() const
+{
+  return code_length;
+}
+
+uint ReedSolomonCode::get_dimension() const
+{
+  return dimension;
+}
+
+vector< uint > ReedSolomonCode::encode_word( vector< uint > message ) const
+{
+  //divide x^( N - K ) m(x) by g(x) and keep the remainder
+  uint redundancy = code_length - dimension;
+  vector< uint > code_word( code_length, 0 );
+  for( uint i = 0; i < dimension; i++ )
+  {
+    code_word.at( redundancy + i ) = message.at( i ) & ( field_size - 1 );
+  }
+  vector< uint > remainder = code_word;
+  for( uint place_value = code_length - 1;
+       place_value != UINT_MAX && place_value >= redundancy; place_value-- )
+  {
+    uint coefficient = remainder.at( place_value );
+    if( coefficient != 0 )
+    {
+      for( uint i = 0; i <= redundancy; i++ )
+      {
+        remainder.at( place_value - redundancy + i ) ^=
+          field_product( coefficient, generator_polynomial.at( i ) );
+      }
+    }
+  }
+  for( uint i = 0; i < redundancy; i++ )
+  {
+    code_word.at( i ) = remainder.at( i );
+  }
+  return code_word;
+}
+
+vector< uint > ReedSolomonCode::extract_message(
+  vector< uint > code_word ) const
+{
+  return vector< uint >( code_word.begin() + ( code_length - dimension ),
+                         code_word.end() );
+}
+
+vector< uint > ReedSolomonCode::decode_word(
+  vector< uint > received_word ) const
+{
+  vector< uint > corrected_word = received_word;
+  if( correct_errors( corrected_word ) )
+  {
+    return corrected_word;
+  }
+  return received_word;
+}
+
+bool ReedSolomonCode::correct_errors( vector< uint > &word ) const
+{
+  //syndromes S_j = r( alpha^j ), 1 <= j <= N - K
+  uint redundancy = code_length - dimension;
+  vector< uint > syndromes( redundancy );
+  bool all_zero = true;
+  for( uint j = 0; j < redundancy; j++ )
+  {
+    syndromes.at( j ) = evaluate( word, exponentials.at( j + 1 ) );
+    all_zero = all_zero && syndromes.at( j ) == 0;
+  }
+  if( all_zero )
+  {
+    return true;
+  }
+
+  //Berlekamp-Massey for the error locator Lambda( x )
+  vector< uint > locator = { 1 };
+  vector< uint > previous = { 1 };
+  uint errors = 0;
+  uint previous_discrepancy = 1;
+  uint gap = 1;
+  for( uint step = 0; step < redundancy; step++ )
+  {
+    uint discrepancy = syndromes.at( step );
+    for( uint i = 1; i <= errors && i < locator.size(); i++ )
+    {
+      discrepancy ^= field_product( locator.at( i ),
+                                    syndromes.at( step - i ) );
+    }
+    if( discrepancy == 0 )
+    {
+      gap++;
+      continue;
+    }
+
+    uint scale = field_quotient( discrepancy, previous_discrepancy );
+    vector< uint > updated = locator;
+    if( updated.size() < previous.size() + gap )
+    {
+      updated.resize( previous.size() + gap, 0 );
+    }
+    for( uint i = 0; i < previous.size(); i++ )
+    {
+      updated.at( i + gap ) ^= field_product( scale, previous.at( i ) );
+    }
+    if( 2 * errors <= step )
+    {
+      previous = locator;
+      errors = step + 1 - errors;
+      previous_discrepancy = discrepancy;
+      gap = 1;
+    }
+    else
+    {
+      gap++;
+    }
+    locator = updated;
+  }
+  locator.resize( errors + 1, 0 );
+  if( 2 * errors > redundancy )
+  {
+    return false;
+  }
+
+  //Omega( x ) = S( x ) Lambda( x ) mod x^( N - K )
+  vector< uint > evaluator( redundancy, 0 );
+  for( uint i = 0; i < redundancy; i++ )
+  {
+    for( uint j = 0; j <= i && j < locator.size(); j++ )
+    {
+      evaluator.at( i ) ^= field_product( locator.at( j ),
+                                          syndromes.at( i - j ) );
+    }
+  }
+
+  //Chien search over the places of the code, then Forney's formula
+  //e = Omega( X^-1 ) / Lambda'( X^-1 ) at each root X^-1
+  uint found = 0;
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    uint inverse_locator =
+      exponentials.at( ( field_size - 1 - place_value ) % ( field_size - 1 ) );
+    if( evaluate( locator, inverse_locator ) != 0 )
+    {
+      continue;
+    }
+    uint derivative = 0;
+    uint power = 1;
+    for( uint i = 1; i < locator.size(); i += 2 )
+    {
+      //odd terms only survive differentiation in characteristic 2
+      derivative ^= field_product( locator.at( i ), power );
+      power = field_product( power,
+                             field_product( inverse_locator, inverse_locator ) );
+    }
+    if( derivative == 0 )
+    {
+      return false;
+    }
+    word.at( place_value ) ^= field_quotient(
+      evaluate( evaluator, inverse_locator ), derivative );
+    found++;
+  }
+  return found == errors;
+}
+
+uint ReedSolomonCode::field_product( uint first, uint second ) const
+{
+  if( first == 0 || second == 0 )
+  {
+    return 0;
+  }
+  return exponentials.at( logarithms.at( first ) + logarithms.at( second ) );
+}
+
+uint ReedSolomonCode::field_quotient( uint dividend, uint divisor ) const
+{
+  if( dividend == 0 )
+  {
+    return 0;
+  }
+  return exponentials.at( logarithms.at( dividend ) + field_size - 1
+                          - logarithms.at( divisor ) );
+}
+
+uint ReedSolomonCode::evaluate( const vector< uint > &polynomial,
+                                uint point ) const
+{
+  //Horner's rule from the highest coefficient down
+  uint value = 0;
+  for( uint i = polynomial.size() - 1; i != UINT_MAX; i-- )
+  {
+    value = field_product( value, point ) ^ polynomial.at( i );
+  }
+  return value;
+}
+
+#endif
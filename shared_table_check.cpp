@@ -0,0 +1,95 @@
+/* A program to check that a syndrome table shared through POSIX
+ * shared memory can be attached to while the process that built it
+ * is still running, both from another process and from a second
+ * table in the same process. It exits with status 1 if an attach
+ * fails, takes more than a few seconds, or decodes differently.
+ * @author Jared Allen
+ * @date October 17, 2026
+ */
+
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "cyclic_codes.h"
+#include "syndrome_table.h"
+#include "check_codes.h"
+
+using namespace std;
+
+/**
+ * attach to the shared table and compare its decoding with the
+ * builder's
+ * @param code the code
+ * @param shared_name the name of the table
+ * @param builder the table of the building process
+ * @return whether the table was shared and decoded the same
+ */
+bool check_attached( const CyclicCode &code, const string &shared_name,
+                     const SyndromeTable &builder );
+
+bool check_attached( const CyclicCode &code, const string &shared_name,
+                     const SyndromeTable &builder )
+{
+  SyndromeTable table( code, shared_name );
+  if( !table.is_shared() )
+  {
+    return false;
+  }
+  uint code_length = code.get_code_length();
+  for( uint word = 0; word < ( 1u << code_length ); word += 101 )
+  {
+    if( table.decode_word( word ) != builder.decode_word( word ) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main()
+{
+  //the ( 23, 12 ) Golay code
+  vector< uint > generator;
+  vector< uint > parity_check;
+  build_matrices( 23, 0xC75, generator, parity_check );
+  CyclicCode code = CyclicCode( generator, parity_check, 23 );
+
+  string shared_name = "/cyclic_codes_check_" + to_string( getpid() );
+  SyndromeTable::remove_shared( shared_name );
+  SyndromeTable builder( code, shared_name );
+  bool passed = builder.is_shared();
+
+  //attach while the builder is alive: a second table here, and one
+  //in a child process; either is killed if it waits too long
+  alarm( 30 );
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+  passed = passed && check_attached( code, shared_name, builder );
+  pid_t child = fork();
+  if( child == 0 )
+  {
+    alarm( 10 );
+    _exit( check_attached( code, shared_name, builder ) ? 0 : 1 );
+  }
+  int status = 0;
+  passed = passed && child > 0 && waitpid( child, &status, 0 ) == child &&
+    WIFEXITED( status ) && WEXITSTATUS( status ) == 0;
+  double seconds = chrono::duration< double >(
+    chrono::steady_clock::now() - start ).count();
+  passed = passed && seconds < 5;
+  SyndromeTable::remove_shared( shared_name );
+
+  cout << "attached while the builder was alive in " << seconds
+       << " s" << endl;
+  if( !passed )
+  {
+    cout << "failed: the shared table could not be attached to." << endl;
+    return 1;
+  }
+  cout << "passed: the shared table was attached to." << endl;
+  return 0;
+}
@@ -0,0 +1,473 @@
+#ifndef SOFT_DECODING_H
+#define SOFT_DECODING_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include "cyclic_codes.h"
+
+using namespace std;
+
+/**
+ * determine the correlation discrepancy of a code word, the sum of
+ * the reliabilities of the places where it disagrees with the hard
+ * decision. Least discrepancy is greatest correlation.
+ * @param disagreement the code word xor the hard decision
+ * @param reliabilities the reliabilities of the places
+ * @param code_length the length of the code
+ * @return the discrepancy
+ */
+float correlation_discrepancy( uint disagreement,
+                               const float *reliabilities,
+                               uint code_length );
+
+/**
+ * A Chase-II decoder, which turns the hard decision decoder of a
+ * cyclic code into a soft decision decoder. Reliabilities are
+ * given as log likelihood ratios log( P( 0 ) / P( 1 ) ), one per
+ * place, so a negative ratio is a received 1 and its magnitude is
+ * the reliability of the place.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class ChaseDecoder
+{
+public:
+  /**
+   * Constructor specifying the code and the number of test places
+   * @param code the cyclic code whose decoder is used
+   * @param num_test_places p, the number of least reliable places
+   * flipped by the 2^p test patterns, at most 16
+   */
+  ChaseDecoder( const CyclicCode &code, uint num_test_places );
+
+  /**
+   * make a hard decision on each place of a received word
+   * @param llrs the log likelihood ratios of the n places
+   * @return the hard decision word
+   */
+  uint hard_decision( const float *llrs ) const;
+
+  /**
+   * decode a word from its log likelihood ratios
+   * @param llrs the log likelihood ratios of the n places
+   * @return the code word with the best correlation to the
+   * received word among the decoded test patterns
+   */
+  uint decode_word( const vector< float > &llrs ) const;
+
+  /**
+   * decode a batch of words. The test patterns of a group of words
+   * are decoded together by the code's batch decoder
+   * @param llrs the log likelihood ratios of the words, n per word
+   * @return the decoded words
+   */
+  vector< uint > decode_batch( const vector< float > &llrs ) const;
+
+private:
+
+  /**
+   * decode a word from the log likelihood ratios it starts at
+   * @param llrs the log likelihood ratios of the n places
+   * @return the decoded word
+   */
+  uint decode_llrs( const float *llrs ) const;
+
+  /**
+   * find the reliabilities of the places of a word and its p least
+   * reliable places
+   * @param llrs the log likelihood ratios of the n places
+   * @param reliabilities set to the n reliabilities
+   * @param test_places set to the p least reliable places
+   */
+  void find_test_places( const float *llrs, float *reliabilities,
+                         uint *test_places ) const;
+
+  /**
+   * flip the test places of a word chosen by a test pattern
+   * @param received_word the hard decision word
+   * @param test_places the p least reliable places
+   * @param pattern the test pattern, bit i for test place i
+   * @return the test word
+   */
+  uint get_test_word( uint received_word, const uint *test_places,
+                      uint pattern ) const;
+
+  /**
+   * keep a decoded test pattern if it is a code word better
+   * correlated with the received word than the best so far
+   * @param candidate the decoded test pattern
+   * @param received_word the hard decision word
+   * @param reliabilities the reliabilities of its places
+   * @param decoded_word the best code word so far
+   * @param least_discrepancy the discrepancy of the best code word
+   */
+  void keep_candidate( uint candidate, uint received_word,
+                       const float *reliabilities, uint &decoded_word,
+                       float &least_discrepancy ) const;
+
+  //2^16 hard decodes per word is already far past the gain of more
+  static const uint MAX_TEST_PLACES = 16;
+
+  //the test patterns decoded together by decode_batch
+  static const uint BATCH_TEST_WORDS = 4096;
+
+  const CyclicCode &code;
+  uint num_test_places;
+  uint code_length;
+};
+
+/**
+ * An ordered statistics decoder of order at most 2. The places are
+ * sorted by reliability, the generator matrix is reduced so that
+ * its pivots lie on the k most reliable independent places, and
+ * every code word that differs from the hard decision on that
+ * basis in at most the given number of places is re-encoded.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class OsdDecoder
+{
+public:
+  /**
+   * Constructor specifying the code and the order
+   * @param code the cyclic code to decode
+   * @param order the number of basis places flipped, 0, 1 or 2
+   */
+  OsdDecoder( const CyclicCode &code, uint order );
+
+  /**
+   * decode a word from its log likelihood ratios
+   * @param llrs the log likelihood ratios of the n places
+   * @return the code word with the best correlation among the
+   * candidates
+   */
+  uint decode_word( const vector< float > &llrs ) const;
+
+  /**
+   * decode a batch of words
+   * @param llrs the log likelihood ratios of the words, n per word
+   * @return the decoded words
+   */
+  vector< uint > decode_batch( const vector< float > &llrs ) const;
+
+private:
+
+  /**
+   * decode a word from the log likelihood ratios it starts at
+   * @param llrs the log likelihood ratios of the n places
+   * @return the decoded word
+   */
+  uint decode_llrs( const float *llrs ) const;
+
+  vector< uint > generator;
+  uint order;
+  uint code_length;
+};
+
+ChaseDecoder::ChaseDecoder( const CyclicCode &param_code,
+                            uint param_num_test_places )
+: code( param_code ), num_test_places( param_num_test_places ),
+  code_length( param_code.get_code_length() )
+{
+  if( num_test_places > code_length )
+  {
+    num_test_places = code_length;
+  }
+  if( num_test_places > MAX_TEST_PLACES )
+  {
+    cout << "Chase decoding is limited to " << MAX_TEST_PLACES
+         << " test places." << endl;
+    num_test_places = MAX_TEST_PLACES;
+  }
+}
+
+uint ChaseDecoder::hard_decision( const float *llrs ) const
+{
+  uint word = 0;
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    word |= static_cast< uint >( llrs[ place_value ] < 0 )
+      << place_value;
+  }
+  return word;
+}
+
+uint ChaseDecoder::decode_word( const vector< float > &llrs ) const
+{
+  return decode_llrs( llrs.data() );
+}
+
+vector< uint > ChaseDecoder::decode_batch(
+  const vector< float > &llrs ) const
+{
+  //gather the test patterns of as many words as fit in a batch, so
+  //the hard decodes go through the code's batch decoder together
+  uint num_words = llrs.size() / code_length;
+  uint num_patterns = 1u << num_test_places;
+  uint group_size = num_patterns < BATCH_TEST_WORDS ?
+    BATCH_TEST_WORDS / num_patterns : 1;
+  vector< uint > decoded_words( num_words );
+  vector< float > reliabilities( group_size * code_length );
+  vector< uint > received_words( group_size );
+  vector< uint > test_words;
+  test_words.reserve( group_size * num_patterns );
+  for( uint first = 0; first < num_words; first += group_size )
+  {
+    uint this_group = num_words - first < group_size ?
+      num_words - first : group_size;
+    test_words.clear();
+    for( uint i = 0; i < this_group; i++ )
+    {
+      const float *word_llrs = llrs.data() + ( first + i ) * code_length;
+      uint test_places[ 32 ];
+      find_test_places( word_llrs, reliabilities.data() + i * code_length,
+                        test_places );
+      received_words.at( i ) = hard_decision( word_llrs );
+      for( uint pattern = 0; pattern < num_patterns; pattern++ )
+      {
+        test_words.push_back(
+          get_test_word( received_words.at( i ), test_places, pattern ) );
+      }
+    }
+
+    vector< uint > candidates = code.decode_batch( test_words );
+    for( uint i = 0; i < this_group; i++ )
+    {
+      uint decoded_word = received_words.at( i );
+      float least_discrepancy = FLT_MAX;
+      for( uint pattern = 0; pattern < num_patterns; pattern++ )
+      {
+        keep_candidate( candidates.at( i * num_patterns + pattern ),
+                        received_words.at( i ),
+                        reliabilities.data() + i * code_length,
+                        decoded_word, least_discrepancy );
+      }
+      decoded_words.at( first + i ) = decoded_word;
+    }
+  }
+  return decoded_words;
+}
+
+uint ChaseDecoder::decode_llrs( const float *llrs ) const
+{
+  float reliabilities[ 32 ];
+  uint test_places[ 32 ];
+  find_test_places( llrs, reliabilities, test_places );
+  uint received_word = hard_decision( llrs );
+
+  //decode each test pattern, keeping the best correlated code word.
+  //if no pattern decodes to a code word, keep the hard decision
+  uint decoded_word = received_word;
+  float least_discrepancy = FLT_MAX;
+  for( uint pattern = 0; pattern < ( 1u << num_test_places ); pattern++ )
+  {
+    uint candidate = code.decode_word(
+      get_test_word( received_word, test_places, pattern ) );
+    keep_candidate( candidate, received_word, reliabilities,
+                    decoded_word, least_discrepancy );
+  }
+  return decoded_word;
+}
+
+void ChaseDecoder::find_test_places( const float *llrs,
+                                     float *reliabilities,
+                                     uint *test_places ) const
+{
+  //determine the reliability of each place
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    reliabilities[ place_value ] = fabs( llrs[ place_value ] );
+  }
+
+  //select the p least reliable places
+  uint chosen_places = 0;
+  for( uint i = 0; i < num_test_places; i++ )
+  {
+    uint least_place = 0;
+    float least_reliability = FLT_MAX;
+    for( uint place_value = 0; place_value < code_length; place_value++ )
+    {
+      if( ( ( chosen_places >> place_value ) & 1 ) == 0 &&
+          reliabilities[ place_value ] < least_reliability )
+      {
+        least_reliability = reliabilities[ place_value ];
+        least_place = place_value;
+      }
+    }
+    test_places[ i ] = least_place;
+    chosen_places |= 1u << least_place;
+  }
+}
+
+uint ChaseDecoder::get_test_word( uint received_word,
+                                  const uint *test_places,
+                                  uint pattern ) const
+{
+  uint test_word = received_word;
+  for( uint i = 0; i < num_test_places; i++ )
+  {
+    test_word ^= ( ( pattern >> i ) & 1 ) << test_places[ i ];
+  }
+  return test_word;
+}
+
+void ChaseDecoder::keep_candidate( uint candidate, uint received_word,
+                                   const float *reliabilities,
+                                   uint &decoded_word,
+                                   float &least_discrepancy ) const
+{
+  if( !code.is_code_word( candidate ) )
+  {
+    return;
+  }
+  float this_discrepancy = correlation_discrepancy(
+    candidate ^ received_word, reliabilities, code_length );
+  if( this_discrepancy < least_discrepancy )
+  {
+    least_discrepancy = this_discrepancy;
+    decoded_word = candidate;
+  }
+}
+
+float correlation_discrepancy( uint disagreement,
+                               const float *reliabilities,
+                               uint code_length )
+{
+  //branch free so the sum vectorizes over the places
+  float sum = 0;
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    sum += static_cast< float >( ( disagreement >> place_value ) & 1 )
+      * reliabilities[ place_value ];
+  }
+  return sum;
+}
+
+OsdDecoder::OsdDecoder( const CyclicCode &code, uint param_order )
+: generator( code.get_generator() ), order( param_order ),
+  code_length( code.get_code_length() )
+{
+  if( order > 2 )
+  {
+    cout << "ordered statistics decoding is limited to order 2."
+         << endl;
+    order = 2;
+  }
+}
+
+uint OsdDecoder::decode_word( const vector< float > &llrs ) const
+{
+  return decode_llrs( llrs.data() );
+}
+
+vector< uint > OsdDecoder::decode_batch(
+  const vector< float > &llrs ) const
+{
+  uint num_words = llrs.size() / code_length;
+  vector< uint > decoded_words( num_words );
+  for( uint i = 0; i < num_words; i++ )
+  {
+    decoded_words.at( i ) = decode_llrs( llrs.data() + i * code_length );
+  }
+  return decoded_words;
+}
+
+uint OsdDecoder::decode_llrs( const float *llrs ) const
+{
+  //sort the places from most to least reliable
+  float reliabilities[ 32 ];
+  uint sorted_places[ 32 ];
+  uint received_word = 0;
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    reliabilities[ place_value ] = fabs( llrs[ place_value ] );
+    sorted_places[ place_value ] = place_value;
+    received_word |= static_cast< uint >( llrs[ place_value ] < 0 )
+      << place_value;
+  }
+  sort( sorted_places, sorted_places + code_length,
+        [ &reliabilities ]( uint first, uint second )
+        {
+          return reliabilities[ first ] > reliabilities[ second ];
+        } );
+
+  //Gauss-Jordan on the packed rows, taking pivots in order of
+  //reliability, so the pivots form the most reliable basis
+  uint rows[ 32 ];
+  uint basis_places[ 32 ];
+  uint dimension = generator.size();
+  for( uint row = 0; row < dimension; row++ )
+  {
+    rows[ row ] = generator.at( row );
+  }
+  uint rank = 0;
+  for( uint i = 0; i < code_length && rank < dimension; i++ )
+  {
+    uint column_mask = 1u << sorted_places[ i ];
+    uint pivot_row = rank;
+    while( pivot_row < dimension && ( rows[ pivot_row ] & column_mask ) == 0 )
+    {
+      pivot_row++;
+    }
+    if( pivot_row == dimension )
+    {
+      continue;
+    }
+    swap( rows[ rank ], rows[ pivot_row ] );
+    for( uint row = 0; row < dimension; row++ )
+    {
+      if( row != rank && ( rows[ row ] & column_mask ) != 0 )
+      {
+        rows[ row ] ^= rows[ rank ];
+      }
+    }
+    basis_places[ rank ] = sorted_places[ i ];
+    rank++;
+  }
+
+  //order 0: re-encode the hard decision on the basis
+  uint base_word = 0;
+  for( uint row = 0; row < rank; row++ )
+  {
+    if( ( ( received_word >> basis_places[ row ] ) & 1 ) == 1 )
+    {
+      base_word ^= rows[ row ];
+    }
+  }
+  uint decoded_word = base_word;
+  float least_discrepancy = correlation_discrepancy(
+    base_word ^ received_word, reliabilities, code_length );
+
+  //orders 1 and 2: flipping a basis place adds its row
+  for( uint first = 0; first < rank && order >= 1; first++ )
+  {
+    uint first_word = base_word ^ rows[ first ];
+    float this_discrepancy = correlation_discrepancy(
+      first_word ^ received_word, reliabilities, code_length );
+    if( this_discrepancy < least_discrepancy )
+    {
+      least_discrepancy = this_discrepancy;
+      decoded_word = first_word;
+    }
+
+    for( uint second = first + 1; second < rank && order >= 2; second++ )
+    {
+      uint second_word = first_word ^ rows[ second ];
+      this_discrepancy = correlation_discrepancy(
+        second_word ^ received_word, reliabilities, code_length );
+      if( this_discrepancy < least_discrepancy )
+      {
+        least_discrepancy = this_discrepancy;
+        decoded_word = second_word;
+      }
+    }
+  }
+  return decoded_word;
+}
+
+#endif
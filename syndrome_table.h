@@ -0,0 +1,866 @@
+#ifndef SYNDROME_TABLE_H
+#define SYNDROME_TABLE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <climits>
+#include <cerrno>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "cyclic_codes.h"
+#include "table_placement.h"
+
+using namespace std;
+
+/**
+ * A table of coset leaders for a binary linear code, indexed by
+ * syndrome, so a received word is decoded with one lookup. The
+ * syndrome has bit r from row r of the parity check matrix, and the
+ * coset leader is a least weight word with that syndrome.
+ *
+ * The table can live in a named POSIX shared memory segment, or in a
+ * file on a hugetlbfs mount, so that many decoder processes on a
+ * host share one copy. The first process to open the name builds
+ * the table; the others map it read only, waiting until it is
+ * complete, and check that it was built for the same code. The
+ * builder holds a lock on the segment until the table is ready, so
+ * a segment left unfinished by a builder that died is found, removed
+ * and built again rather than waited on forever.
+ *
+ * A path on an ordinary filesystem gives an out of core table for
+ * large n - k: the file is sparse until built, the mapping is
+ * advised for random access so the kernel does not read ahead, and
+ * batches are decoded in order of syndrome, so lookups falling in
+ * one page are made together and the next ones are prefetched.
+ *
+ * A private table can be backed by huge pages and copied to every
+ * NUMA node, each copy written by a thread pinned to that node so
+ * its pages are placed there; lookups then use the copy of the node
+ * the calling thread is running on.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class SyndromeTable
+{
+public:
+  /**
+   * Constructor building a table private to this process
+   * @param code the code to decode
+   * @param num_threads the number of threads to build with, or 0
+   * for one per hardware thread
+   * @param placement TablePlacement flags for the table's pages
+   */
+  SyndromeTable( const CyclicCode &code, uint num_threads = 0,
+                 uint placement = SMALL_PAGES );
+
+  /**
+   * Constructor sharing the table between processes
+   * @param code the code to decode
+   * @param shared_name a POSIX shared memory name such as
+   * "/cyclic_23", or the path of a file on a hugetlbfs mount such as
+   * "/dev/hugepages/cyclic_23"
+   * @param num_threads the number of threads to build with, or 0
+   * for one per hardware thread
+   */
+  SyndromeTable( const CyclicCode &code, const string &shared_name,
+                 uint num_threads = 0 );
+
+  /**
+   * Destructor unmapping a shared table; the segment itself stays
+   * until remove_shared
+   */
+  ~SyndromeTable();
+
+  SyndromeTable( const SyndromeTable & ) = delete;
+  SyndromeTable &operator=( const SyndromeTable & ) = delete;
+
+  /**
+   * remove a shared table, once no new process will need it
+   * @param shared_name the name the table was shared under
+   */
+  static void remove_shared( const string &shared_name );
+
+  /**
+   * Return the number of rows of the parity check matrix, n - k
+   */
+  uint get_redundancy() const;
+
+  /**
+   * determine if the table is mapped from a shared segment
+   */
+  bool is_shared() const;
+
+  /**
+   * Return the number of per node copies of the table, or 0 if there
+   * is a single copy
+   */
+  uint get_num_replicas() const;
+
+  /**
+   * restrict the calling thread to the processors of a NUMA node, so
+   * its lookups stay on that node's copy
+   * @param node the node
+   * @return whether the affinity was set
+   */
+  static bool pin_thread_to_node( uint node );
+
+  /**
+   * compute the syndrome of a word
+   * @param word the word
+   * @return the syndrome, bit r from row r of the parity check matrix
+   */
+  uint get_syndrome( uint word ) const;
+
+  /**
+   * Return the coset leader for a syndrome
+   */
+  uint get_coset_leader( uint syndrome ) const;
+
+  /**
+   * decode the received word
+   * @param received_word the word to be decoded
+   * @return the received word minus the leader of its coset
+   */
+  uint decode_word( uint received_word ) const;
+
+  /**
+   * decode a batch of received words, looking their leaders up in
+   * order of syndrome
+   * @param received_words the words to be decoded
+   * @return the decoded words, in the order received
+   */
+  vector< uint > decode_batch( const vector< uint > &received_words ) const;
+
+private:
+
+  /**
+   * The start of a shared segment, followed by the coset leaders
+   */
+  struct SharedHeader
+  {
+    uint64_t magic;
+    uint32_t code_length;
+    uint32_t redundancy;
+    uint32_t parity_check[ 32 ];
+    uint32_t ready;
+  };
+
+  /**
+   * build a table private to this process, placed as asked
+   * @param placement TablePlacement flags for the table's pages
+   */
+  void build_private( uint placement );
+
+  /**
+   * Return the copy of the table for the node the calling thread is
+   * running on
+   */
+  const uint *get_leaders() const;
+
+  /**
+   * fill in the coset leader of every syndrome
+   * @param table the 2^( n - k ) entries, all zero
+   */
+  void build( uint *table ) const;
+
+  /**
+   * offer every error of one weight whose lowest bit is in a given
+   * place to the table
+   * @param table the entries
+   * @param weight the weight of the errors
+   * @param lowest_place the place of the lowest bit
+   * @param stop set once every syndrome has a leader
+   * @return the number of entries this filled
+   */
+  uint64_t offer_errors( uint *table, uint weight, uint lowest_place,
+                         const atomic< bool > &stop ) const;
+
+  /**
+   * put an error in the table if its entry is still empty
+   * @return whether the entry was empty
+   */
+  static bool offer_error( uint *entry, uint error );
+
+  /**
+   * The outcomes of attaching to a segment another process created
+   */
+  enum AttachResult
+  {
+    ATTACHED,
+    NOT_ATTACHED,
+    ABANDONED
+  };
+
+  /**
+   * create or attach to the shared segment
+   * @param shared_name the name of the segment
+   * @return whether the table is now mapped
+   */
+  bool map_shared( const string &shared_name );
+
+  /**
+   * build the table in a segment this process has just created
+   * @param shared_name the name of the segment
+   * @param descriptor the segment, locked exclusively by this process
+   * @return whether the table is now mapped
+   */
+  bool build_shared( const string &shared_name, int descriptor );
+
+  /**
+   * wait for the builder of a segment to finish and map the table
+   * @param shared_name the name of the segment
+   * @param descriptor the segment, opened read only
+   * @return ABANDONED if the builder released the segment without
+   * finishing the table
+   */
+  AttachResult attach_shared( const string &shared_name, int descriptor );
+
+  /**
+   * remove a segment abandoned by its builder, unless the name has
+   * already been taken by a new segment
+   * @param shared_name the name of the segment
+   * @param descriptor the abandoned segment
+   */
+  static void remove_abandoned( const string &shared_name, int descriptor );
+
+  /**
+   * advise the kernel how a mapped table will be used
+   * @param address the start of the mapping
+   */
+  void advise( void *address ) const;
+
+  /**
+   * determine if a name is a file path rather than a shared memory
+   * name
+   */
+  static bool is_file_path( const string &shared_name );
+
+  /**
+   * Return the number of bytes to map for a table
+   */
+  size_t get_mapping_size( const string &shared_name ) const;
+
+  static const uint64_t MAGIC = 0x4359434c53594e44ULL;
+
+  vector< uint > parity_check;
+  vector< uint > parity_columns;
+  vector< pair< void *, size_t > > allocations;
+  vector< const uint * > node_leaders;
+  vector< uint > cpu_nodes;
+  const uint *leaders;
+  void *mapping;
+  size_t mapping_size;
+  uint code_length;
+  uint redundancy;
+  uint num_threads;
+};
+
+SyndromeTable::SyndromeTable( const CyclicCode &code,
+                              uint param_num_threads, uint placement )
+: parity_check( code.get_parity_check() ), leaders( nullptr ),
+  mapping( nullptr ), mapping_size( 0 ),
+  code_length( code.get_code_length() ),
+  redundancy( code.get_parity_check().size() ),
+  num_threads( param_num_threads )
+{
+  //column i of the parity check matrix is the syndrome of x^i
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    parity_columns.push_back( get_syndrome( 1u << place_value ) );
+  }
+  if( num_threads == 0 )
+  {
+    num_threads = thread::hardware_concurrency() > 0 ?
+      thread::hardware_concurrency() : 1;
+  }
+
+  build_private( placement );
+}
+
+SyndromeTable::SyndromeTable( const CyclicCode &code,
+                              const string &shared_name,
+                              uint param_num_threads )
+: parity_check( code.get_parity_check() ), leaders( nullptr ),
+  mapping( nullptr ), mapping_size( 0 ),
+  code_length( code.get_code_length() ),
+  redundancy( code.get_parity_check().size() ),
+  num_threads( param_num_threads )
+{
+  //column i of the parity check matrix is the syndrome of x^i
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    parity_columns.push_back( get_syndrome( 1u << place_value ) );
+  }
+  if( num_threads == 0 )
+  {
+    num_threads = thread::hardware_concurrency() > 0 ?
+      thread::hardware_concurrency() : 1;
+  }
+
+  if( !map_shared( shared_name ) )
+  {
+    cout << "could not share the syndrome table as " << shared_name
+         << "; building a private one." << endl;
+    build_private( SMALL_PAGES );
+  }
+}
+
+SyndromeTable::~SyndromeTable()
+{
+  if( mapping != nullptr )
+  {
+    munmap( mapping, mapping_size );
+  }
+  for( pair< void *, size_t > allocation : allocations )
+  {
+    munmap( allocation.first, allocation.second );
+  }
+}
+
+void SyndromeTable::remove_shared( const string &shared_name )
+{
+  if( is_file_path( shared_name ) )
+  {
+    unlink( shared_name.c_str() );
+  }
+  else
+  {
+    shm_unlink( shared_name.c_str() );
+  }
+}
+
+uint SyndromeTable::get_redundancy() const
+{
+  return redundancy;
+}
+
+bool SyndromeTable::is_shared() const
+{
+  return mapping != nullptr;
+}
+
+uint SyndromeTable::get_num_replicas() const
+{
+  return node_leaders.size();
+}
+
+bool SyndromeTable::pin_thread_to_node( uint node )
+{
+  vector< vector< uint > > node_cpus = get_node_cpus();
+  return node < node_cpus.size() && pin_thread_to_cpus( node_cpus.at( node ) );
+}
+
+uint SyndromeTable::get_syndrome( uint word ) const
+{
+  uint syndrome = 0;
+  for( uint row = 0; row < redundancy; row++ )
+  {
+    syndrome |= uint( __builtin_parity( word & parity_check[ row ] ) )
+      << row;
+  }
+  return syndrome;
+}
+
+uint SyndromeTable::get_coset_leader( uint syndrome ) const
+{
+  return get_leaders()[ syndrome ];
+}
+
+uint SyndromeTable::decode_word( uint received_word ) const
+{
+  return received_word ^ get_leaders()[ get_syndrome( received_word ) ];
+}
+
+vector< uint > SyndromeTable::decode_batch(
+  const vector< uint > &received_words ) const
+{
+  //sort by syndrome so lookups sweep the table in one direction
+  vector< pair< uint, uint > > lookups( received_words.size() );
+  for( uint i = 0; i < received_words.size(); i++ )
+  {
+    lookups[ i ] = make_pair( get_syndrome( received_words[ i ] ), i );
+  }
+  sort( lookups.begin(), lookups.end() );
+
+  const uint PREFETCH_DISTANCE = 8;
+  const uint *table = get_leaders();
+  vector< uint > decoded_words( received_words.size() );
+  for( uint i = 0; i < lookups.size(); i++ )
+  {
+    if( i + PREFETCH_DISTANCE < lookups.size() )
+    {
+      __builtin_prefetch( table + lookups[ i + PREFETCH_DISTANCE ].first );
+    }
+    uint index = lookups[ i ].second;
+    decoded_words[ index ] =
+      received_words[ index ] ^ table[ lookups[ i ].first ];
+  }
+  return decoded_words;
+}
+
+void SyndromeTable::build_private( uint placement )
+{
+  size_t table_size = ( size_t( 1 ) << redundancy ) * sizeof( uint );
+  uint *table = static_cast< uint * >( allocate_table( table_size,
+                                                       placement ) );
+  if( table == nullptr )
+  {
+    cout << "could not allocate the syndrome table." << endl;
+    table_size = sizeof( uint );
+    table = static_cast< uint * >( allocate_table( table_size,
+                                                   SMALL_PAGES ) );
+    redundancy = 0;
+  }
+  build( table );
+  leaders = table;
+  if( ( placement & NODE_REPLICAS ) == 0 )
+  {
+    allocations.push_back( make_pair( table, table_size ) );
+    return;
+  }
+
+  //copy the table to each node from a thread pinned there, so the
+  //copy's pages are first touched, and so placed, on that node
+  vector< vector< uint > > node_cpus = get_node_cpus();
+  node_leaders.assign( node_cpus.size(), table );
+  for( uint node = 0; node < node_cpus.size(); node++ )
+  {
+    thread copier( [ this, &node_cpus, node, table, table_size,
+                     placement ]()
+    {
+      pin_thread_to_cpus( node_cpus.at( node ) );
+      size_t replica_size = table_size;
+      void *replica = allocate_table( replica_size, placement );
+      if( replica != nullptr )
+      {
+        copy( table, table + ( size_t( 1 ) << redundancy ),
+              static_cast< uint * >( replica ) );
+        allocations.push_back( make_pair( replica, replica_size ) );
+        node_leaders.at( node ) = static_cast< const uint * >( replica );
+      }
+    } );
+    copier.join();
+    for( uint cpu : node_cpus.at( node ) )
+    {
+      if( cpu >= cpu_nodes.size() )
+      {
+        cpu_nodes.resize( cpu + 1, 0 );
+      }
+      cpu_nodes.at( cpu ) = node;
+    }
+  }
+
+  //the built table is kept only where a copy could not be made
+  bool table_used = false;
+  for( const uint *replica : node_leaders )
+  {
+    table_used = table_used || replica == table;
+  }
+  if( table_used )
+  {
+    allocations.push_back( make_pair( table, table_size ) );
+  }
+  else
+  {
+    munmap( table, table_size );
+  }
+  leaders = node_leaders.at( 0 );
+}
+
+const uint *SyndromeTable::get_leaders() const
+{
+  if( node_leaders.size() > 1 )
+  {
+    int cpu = sched_getcpu();
+    if( cpu >= 0 && uint( cpu ) < cpu_nodes.size() )
+    {
+      return node_leaders[ cpu_nodes[ cpu ] ];
+    }
+  }
+  return leaders;
+}
+
+void SyndromeTable::build( uint *table ) const
+{
+  //the errors are offered in increasing weight, so the first to
+  //reach a syndrome is a lightest one, and building stops once every
+  //syndrome has a leader, after about as many errors as cosets.
+  //Within a weight the threads take the places of the lowest bit in
+  //turn, as the errors with a low lowest bit are the most numerous;
+  //which of several lightest errors leads a coset depends on which
+  //thread gets there first
+  uint64_t num_syndromes = uint64_t( 1 ) << redundancy;
+  atomic< uint64_t > num_filled( 1 );
+  atomic< bool > stop( num_syndromes == 1 );
+  for( uint weight = 1; weight <= code_length && !stop; weight++ )
+  {
+    atomic< uint > next_place( 0 );
+    vector< thread > threads;
+    for( uint t = 0; t < num_threads; t++ )
+    {
+      threads.push_back( thread( [ this, table, weight, num_syndromes,
+                                   &num_filled, &stop, &next_place ]()
+      {
+        for( uint lowest_place = next_place++;
+             lowest_place + weight <= code_length && !stop;
+             lowest_place = next_place++ )
+        {
+          uint64_t filled = offer_errors( table, weight, lowest_place,
+                                          stop );
+          if( ( num_filled += filled ) >= num_syndromes )
+          {
+            stop = true;
+          }
+        }
+      } ) );
+    }
+    for( thread &worker : threads )
+    {
+      worker.join();
+    }
+  }
+}
+
+uint64_t SyndromeTable::offer_errors( uint *table, uint weight,
+                                      uint lowest_place,
+                                      const atomic< bool > &stop ) const
+{
+  uint error = 1u << lowest_place;
+  uint syndrome = parity_columns.at( lowest_place );
+  uint64_t filled = 0;
+  uint rest = weight - 1;
+  uint first_place = lowest_place + 1;
+  uint num_places = code_length - first_place;
+  if( rest == 0 )
+  {
+    return offer_error( table + syndrome, error ) ? 1 : 0;
+  }
+
+  //the other bits run over the rest-subsets of the places above in
+  //revolving door order (Knuth, Algorithm 7.2.1.3R), so each step
+  //swaps one place out and one in, and the syndrome changes by two
+  //columns of the parity check matrix
+  uint places[ 34 ];
+  for( uint j = 1; j <= rest; j++ )
+  {
+    places[ j ] = j - 1;
+    error |= 1u << ( first_place + j - 1 );
+    syndrome ^= parity_columns[ first_place + j - 1 ];
+  }
+  places[ rest + 1 ] = num_places;
+
+  uint64_t steps = 0;
+  while( true )
+  {
+    if( syndrome != 0 && offer_error( table + syndrome, error ) )
+    {
+      filled++;
+    }
+    if( ( ++steps & 0xFFFF ) == 0 && stop )
+    {
+      break;
+    }
+
+    //find the next subset, as the place swapped out and in
+    uint out_place;
+    uint in_place;
+    uint j = 2;
+    bool increase;
+    if( rest % 2 == 1 )
+    {
+      if( places[ 1 ] + 1 < places[ 2 ] )
+      {
+        out_place = places[ 1 ];
+        in_place = ++places[ 1 ];
+        j = 0;
+      }
+      increase = false;
+    }
+    else
+    {
+      if( places[ 1 ] > 0 )
+      {
+        out_place = places[ 1 ];
+        in_place = --places[ 1 ];
+        j = 0;
+      }
+      increase = true;
+    }
+    while( j != 0 && j <= rest )
+    {
+      if( !increase )
+      {
+        //places[ j ] is places[ j - 1 ] + 1; try to decrease it
+        if( places[ j ] >= j )
+        {
+          out_place = places[ j ];
+          in_place = j - 2;
+          places[ j ] = places[ j - 1 ];
+          places[ j - 1 ] = j - 2;
+          j = 0;
+          break;
+        }
+      }
+      else
+      {
+        //places[ j - 1 ] is j - 2; try to increase places[ j ]
+        if( places[ j ] + 1 < places[ j + 1 ] )
+        {
+          out_place = places[ j - 1 ];
+          in_place = places[ j ] + 1;
+          places[ j - 1 ] = places[ j ];
+          places[ j ]++;
+          j = 0;
+          break;
+        }
+      }
+      j++;
+      increase = !increase;
+    }
+    if( j != 0 )
+    {
+      break;
+    }
+    error ^= ( 1u << ( first_place + out_place ) ) |
+      ( 1u << ( first_place + in_place ) );
+    syndrome ^= parity_columns[ first_place + out_place ] ^
+      parity_columns[ first_place + in_place ];
+  }
+  return filled;
+}
+
+bool SyndromeTable::offer_error( uint *entry, uint error )
+{
+  uint empty = 0;
+  return __atomic_load_n( entry, __ATOMIC_RELAXED ) == 0 &&
+    __atomic_compare_exchange_n( entry, &empty, error, false,
+                                 __ATOMIC_RELAXED, __ATOMIC_RELAXED );
+}
+
+bool SyndromeTable::map_shared( const string &shared_name )
+{
+  if( redundancy > 31 )
+  {
+    return false;
+  }
+  bool file_path = is_file_path( shared_name );
+  mapping_size = get_mapping_size( shared_name );
+
+  //the first process to create the name builds the table; a segment
+  //abandoned by its builder is removed and the race to build it run
+  //again
+  const uint MAX_ATTEMPTS = 3;
+  for( uint attempt = 0; attempt < MAX_ATTEMPTS; attempt++ )
+  {
+    int descriptor = file_path ?
+      open( shared_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644 ) :
+      shm_open( shared_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644 );
+    if( descriptor >= 0 )
+    {
+      return build_shared( shared_name, descriptor );
+    }
+    if( errno != EEXIST )
+    {
+      return false;
+    }
+
+    descriptor = file_path ? open( shared_name.c_str(), O_RDONLY ) :
+      shm_open( shared_name.c_str(), O_RDONLY, 0 );
+    if( descriptor < 0 )
+    {
+      //removed since, as abandoned; try to create it again
+      if( errno == ENOENT )
+      {
+        continue;
+      }
+      return false;
+    }
+    AttachResult result = attach_shared( shared_name, descriptor );
+    if( result == ABANDONED )
+    {
+      cout << shared_name << " was left unfinished by its builder;"
+           << " building it again." << endl;
+      remove_abandoned( shared_name, descriptor );
+    }
+    close( descriptor );
+    if( result != ABANDONED )
+    {
+      return result == ATTACHED;
+    }
+  }
+  return false;
+}
+
+bool SyndromeTable::build_shared( const string &shared_name,
+                                  int descriptor )
+{
+  //hold the lock until the table is ready; if this process dies the
+  //lock goes with it, which tells the others the segment is
+  //abandoned
+  if( flock( descriptor, LOCK_EX ) != 0 ||
+      ftruncate( descriptor, mapping_size ) != 0 )
+  {
+    close( descriptor );
+    remove_shared( shared_name );
+    return false;
+  }
+  void *address = mmap( nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, descriptor, 0 );
+  if( address == MAP_FAILED )
+  {
+    close( descriptor );
+    remove_shared( shared_name );
+    return false;
+  }
+  advise( address );
+  SharedHeader *header = static_cast< SharedHeader * >( address );
+  uint *table = reinterpret_cast< uint * >( header + 1 );
+  build( table );
+  header->magic = MAGIC;
+  header->code_length = code_length;
+  header->redundancy = redundancy;
+  for( uint row = 0; row < redundancy; row++ )
+  {
+    header->parity_check[ row ] = parity_check.at( row );
+  }
+  __atomic_store_n( &header->ready, 1, __ATOMIC_RELEASE );
+
+  //the lock belongs to the open file, which the mapping keeps open
+  //after the descriptor is closed, so release it explicitly
+  flock( descriptor, LOCK_UN );
+  close( descriptor );
+  mapping = address;
+  leaders = table;
+  return true;
+}
+
+SyndromeTable::AttachResult SyndromeTable::attach_shared(
+  const string &shared_name, int descriptor )
+{
+  //a shared lock is granted only while the builder does not hold
+  //its exclusive one, so it waits out a live builder however long
+  //the build takes. Unlocked but not ready means the builder died,
+  //or has created the segment but not yet locked it, so look again
+  //for a while before calling it abandoned.
+  const uint MAX_LOOKS = 100;
+  for( uint look = 0; look < MAX_LOOKS; look++ )
+  {
+    if( flock( descriptor, LOCK_SH ) != 0 )
+    {
+      return NOT_ATTACHED;
+    }
+    struct stat status;
+    if( fstat( descriptor, &status ) != 0 )
+    {
+      flock( descriptor, LOCK_UN );
+      return NOT_ATTACHED;
+    }
+    if( status.st_size != 0 && size_t( status.st_size ) != mapping_size )
+    {
+      flock( descriptor, LOCK_UN );
+      cout << shared_name << " holds the table of another code." << endl;
+      return NOT_ATTACHED;
+    }
+    if( status.st_size != 0 )
+    {
+      void *address = mmap( nullptr, mapping_size, PROT_READ, MAP_SHARED,
+                            descriptor, 0 );
+      if( address == MAP_FAILED )
+      {
+        flock( descriptor, LOCK_UN );
+        return NOT_ATTACHED;
+      }
+      const SharedHeader *header =
+        static_cast< const SharedHeader * >( address );
+      if( __atomic_load_n( &header->ready, __ATOMIC_ACQUIRE ) != 0 )
+      {
+        flock( descriptor, LOCK_UN );
+        bool same_code = header->magic == MAGIC &&
+          header->code_length == code_length &&
+          header->redundancy == redundancy;
+        for( uint row = 0; row < redundancy && same_code; row++ )
+        {
+          same_code = header->parity_check[ row ] == parity_check.at( row );
+        }
+        if( !same_code )
+        {
+          cout << shared_name << " holds the table of another code."
+               << endl;
+          munmap( address, mapping_size );
+          return NOT_ATTACHED;
+        }
+        advise( address );
+        mapping = address;
+        leaders = reinterpret_cast< const uint * >( header + 1 );
+        return ATTACHED;
+      }
+      munmap( address, mapping_size );
+    }
+    flock( descriptor, LOCK_UN );
+    usleep( 1000 );
+  }
+  return ABANDONED;
+}
+
+void SyndromeTable::remove_abandoned( const string &shared_name,
+                                      int descriptor )
+{
+  //another process may have removed the segment and created a new
+  //one under the name already, so compare the files first
+  int named = is_file_path( shared_name ) ?
+    open( shared_name.c_str(), O_RDONLY ) :
+    shm_open( shared_name.c_str(), O_RDONLY, 0 );
+  if( named < 0 )
+  {
+    return;
+  }
+  struct stat abandoned_status;
+  struct stat named_status;
+  if( fstat( descriptor, &abandoned_status ) == 0 &&
+      fstat( named, &named_status ) == 0 &&
+      abandoned_status.st_dev == named_status.st_dev &&
+      abandoned_status.st_ino == named_status.st_ino )
+  {
+    remove_shared( shared_name );
+  }
+  close( named );
+}
+
+void SyndromeTable::advise( void *address ) const
+{
+  //lookups are scattered, so reading ahead only evicts useful pages;
+  //a table small enough to be resident is faulted in at once
+  const size_t RESIDENT_SIZE = size_t( 64 ) << 20;
+  madvise( address, mapping_size,
+           mapping_size > RESIDENT_SIZE ? MADV_RANDOM : MADV_WILLNEED );
+}
+
+bool SyndromeTable::is_file_path( const string &shared_name )
+{
+  //shared memory names have a single leading slash
+  return shared_name.find( '/', 1 ) != string::npos;
+}
+
+size_t SyndromeTable::get_mapping_size( const string &shared_name ) const
+{
+  size_t size = sizeof( SharedHeader ) +
+    ( size_t( 1 ) << redundancy ) * sizeof( uint );
+  if( is_file_path( shared_name ) )
+  {
+    //hugetlbfs files are sized in whole 2 MB pages
+    const size_t HUGE_PAGE = size_t( 2 ) << 20;
+    size = ( size + HUGE_PAGE - 1 ) / HUGE_PAGE * HUGE_PAGE;
+  }
+  return size;
+}
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef TABLE_PLACEMENT_H
+#define TABLE_PLACEMENT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <sched.h>
+#include <sys/mman.h>
+
+using namespace std;
+
+/**
+ * Helpers for placing large decoder tables in memory: page sized
+ * allocations backed by transparent or explicit 2 MB huge pages, so
+ * a table of many megabytes needs few TLB entries, and the NUMA
+ * topology read from sysfs, so a table can be copied to each node
+ * by a thread running there and looked up from the local copy.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+
+/**
+ * The ways a table's pages can be backed, combined as flags
+ */
+enum TablePlacement
+{
+  SMALL_PAGES = 0,
+  TRANSPARENT_HUGE_PAGES = 1,
+  EXPLICIT_HUGE_PAGES = 2,
+  NODE_REPLICAS = 4
+};
+
+/**
+ * allocate zeroed memory for a table
+ * @param size the number of bytes, rounded up to whole huge pages
+ * when huge pages are asked for
+ * @param placement the page flags
+ * @return the memory, or nullptr if it could not be mapped
+ */
+void *allocate_table( size_t &size, uint placement )
+{
+  const size_t HUGE_PAGE = size_t( 2 ) << 20;
+  void *address = MAP_FAILED;
+  if( ( placement & ( TRANSPARENT_HUGE_PAGES | EXPLICIT_HUGE_PAGES ) ) != 0 )
+  {
+    size = ( size + HUGE_PAGE - 1 ) / HUGE_PAGE * HUGE_PAGE;
+  }
+  if( ( placement & EXPLICIT_HUGE_PAGES ) != 0 )
+  {
+    //fails unless huge pages were reserved in vm.nr_hugepages
+    address = mmap( nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+    if( address == MAP_FAILED )
+    {
+      cout << "no explicit huge pages; using transparent ones." << endl;
+      placement |= TRANSPARENT_HUGE_PAGES;
+    }
+  }
+  if( address == MAP_FAILED )
+  {
+    address = mmap( nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if( address == MAP_FAILED )
+    {
+      return nullptr;
+    }
+    if( ( placement & TRANSPARENT_HUGE_PAGES ) != 0 )
+    {
+      madvise( address, size, MADV_HUGEPAGE );
+    }
+  }
+  return address;
+}
+
+/**
+ * read the processors of each NUMA node from sysfs
+ * @return the processors of node i, for each node; one node with no
+ * processors listed if the topology cannot be read
+ */
+vector< vector< uint > > get_node_cpus()
+{
+  vector< vector< uint > > node_cpus;
+  for( uint node = 0; ; node++ )
+  {
+    ifstream cpu_list( "/sys/devices/system/node/node" +
+                       to_string( node ) + "/cpulist" );
+    if( !cpu_list.is_open() )
+    {
+      break;
+    }
+
+    //a list of ranges such as 0-15,32-47
+    vector< uint > cpus;
+    string range;
+    while( getline( cpu_list, range, ',' ) )
+    {
+      uint first = 0;
+      uint last = 0;
+      int num_read = sscanf( range.c_str(), "%u-%u", &first, &last );
+      if( num_read == 1 )
+      {
+        last = first;
+      }
+      for( uint cpu = first; num_read >= 1 && cpu <= last; cpu++ )
+      {
+        cpus.push_back( cpu );
+      }
+    }
+    node_cpus.push_back( cpus );
+  }
+  if( node_cpus.empty() )
+  {
+    node_cpus.push_back( vector< uint >() );
+  }
+  return node_cpus;
+}
+
+/**
+ * restrict the calling thread to the processors of a node
+ * @param cpus the processors of the node
+ * @return whether the affinity was set
+ */
+bool pin_thread_to_cpus( const vector< uint > &cpus )
+{
+  if( cpus.empty() )
+  {
+    return false;
+  }
+  cpu_set_t cpu_set;
+  CPU_ZERO( &cpu_set );
+  for( uint cpu : cpus )
+  {
+    if( cpu < CPU_SETSIZE )
+    {
+      CPU_SET( cpu, &cpu_set );
+    }
+  }
+  return sched_setaffinity( 0, sizeof( cpu_set ), &cpu_set ) == 0;
+}
+
+#endif
@@ -0,0 +1,306 @@
+#ifndef TRELLIS_DECODER_H
+#define TRELLIS_DECODER_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+#include "cyclic_codes.h"
+#include "cpu_features.h"
+
+using namespace std;
+
+/**
+ * A maximum likelihood decoder on the syndrome trellis of Bahl,
+ * Cocke, Jelinek, Raviv and Wolf. The states after place i are the
+ * partial syndromes of the first i places, so there are at most
+ * 2^( n - k ) states in each section, and a bit b in place i moves
+ * state s to s xor b h_i, where h_i is column i of the parity check
+ * matrix. The Viterbi algorithm finds the least cost path from the
+ * zero state back to the zero state in time n 2^( n - k ). Each
+ * section is updated eight states at a time with AVX2 when the
+ * processor has it, with the same results as the portable loop. A
+ * code with more than 24 parity checks is decoded by the code
+ * itself instead. The path metrics and decisions are allocated once
+ * per decoder, so a decoder must not be shared between threads.
+ * @author Jared Allen
+ * @version 17 October 2026
+ */
+class TrellisDecoder
+{
+public:
+  /**
+   * Constructor specifying the code
+   * @param code the cyclic code to decode
+   */
+  TrellisDecoder( const CyclicCode &code );
+
+  /**
+   * determine if the trellis is small enough to decode on, at most
+   * 2^24 states per section
+   * @return if the code is decoded on the trellis
+   */
+  bool is_applicable() const;
+
+  /**
+   * decode a hard decision word, each disagreement costing 1
+   * @param received_word the word to be decoded
+   * @return the nearest code word, or the code's decoding if the
+   * trellis is too large
+   */
+  uint decode_word( uint received_word ) const;
+
+  /**
+   * decode a word from its log likelihood ratios
+   * @param llrs the log likelihood ratios log( P( 0 ) / P( 1 ) ) of
+   * the n places
+   * @return the most likely code word, or the code's decoding of the
+   * hard decisions if the trellis is too large
+   */
+  uint decode_word( const vector< float > &llrs ) const;
+
+private:
+
+  /**
+   * run the Viterbi algorithm over the trellis
+   * @param received_word the hard decision word
+   * @param reliabilities the cost of disagreeing in each place
+   * @return the code word of least total cost
+   */
+  uint viterbi( uint received_word, const float *reliabilities ) const;
+
+  /**
+   * add, compare and select over one section of the trellis
+   * @param metrics the path metrics entering the section
+   * @param new_metrics the path metrics leaving the section
+   * @param decisions one bit per state, set where the survivor
+   * entering the state has bit 1 in this place
+   * @param column the column of the parity check matrix
+   * @param zero_cost the cost of bit 0 in this place
+   * @param one_cost the cost of bit 1 in this place
+   */
+  void add_compare_select( const float *metrics, float *new_metrics,
+                           uint8_t *decisions, uint column,
+                           float zero_cost, float one_cost ) const;
+
+  /**
+   * add, compare and select over one section, one state at a time
+   */
+  void add_compare_select_portable( const float *metrics,
+                                    float *new_metrics,
+                                    uint8_t *decisions, uint column,
+                                    float zero_cost,
+                                    float one_cost ) const;
+
+  /**
+   * add, compare and select over one section, eight states at a time
+   */
+  void add_compare_select_avx2( const float *metrics, float *new_metrics,
+                                uint8_t *decisions, uint column,
+                                float zero_cost, float one_cost ) const;
+
+  //more states per section than this would take gigabytes
+  static const uint MAX_PARITY_CHECKS = 24;
+
+  const CyclicCode &code;
+  vector< uint > parity_columns;
+  uint code_length;
+  uint num_states;
+  bool applicable;
+  bool vectorized;
+
+  //scratch for viterbi, reused by every decode
+  mutable vector< uint8_t > decisions;
+  mutable vector< float > metrics;
+  mutable vector< float > new_metrics;
+};
+
+TrellisDecoder::TrellisDecoder( const CyclicCode &param_code )
+: code( param_code ), code_length( param_code.get_code_length() ),
+  num_states( 0 ), applicable( false ), vectorized( false )
+{
+  //h_i holds bit r of column i of the parity check matrix in place r
+  vector< uint > parity_check = code.get_parity_check();
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    uint column = 0;
+    for( uint row = 0; row < parity_check.size(); row++ )
+    {
+      column |= ( ( parity_check.at( row ) >> place_value ) & 1 ) << row;
+    }
+    parity_columns.push_back( column );
+  }
+
+  if( parity_check.size() > MAX_PARITY_CHECKS )
+  {
+    cout << "the trellis has more than 2^" << MAX_PARITY_CHECKS
+         << " states per section; decoding with the code instead."
+         << endl;
+    return;
+  }
+  num_states = 1u << parity_check.size();
+  applicable = true;
+  vectorized = get_cpu_features().avx2 && num_states >= 8;
+
+  //the decisions are kept one bit per state for the traceback
+  decisions.resize( code_length * ( ( num_states + 7 ) / 8 ) );
+  metrics.resize( num_states );
+  new_metrics.resize( num_states );
+}
+
+bool TrellisDecoder::is_applicable() const
+{
+  return applicable;
+}
+
+uint TrellisDecoder::decode_word( uint received_word ) const
+{
+  if( !applicable )
+  {
+    return code.decode_word( received_word );
+  }
+  float reliabilities[ 32 ];
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    reliabilities[ place_value ] = 1.0f;
+  }
+  return viterbi( received_word, reliabilities );
+}
+
+uint TrellisDecoder::decode_word( const vector< float > &llrs ) const
+{
+  float reliabilities[ 32 ];
+  uint received_word = 0;
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    reliabilities[ place_value ] = fabs( llrs.at( place_value ) );
+    received_word |= static_cast< uint >( llrs.at( place_value ) < 0 )
+      << place_value;
+  }
+  if( !applicable )
+  {
+    return code.decode_word( received_word );
+  }
+  return viterbi( received_word, reliabilities );
+}
+
+uint TrellisDecoder::viterbi( uint received_word,
+                              const float *reliabilities ) const
+{
+  //every decision bit is written before the traceback reads it, so
+  //only the metrics need resetting
+  uint decision_bytes = ( num_states + 7 ) / 8;
+  fill( metrics.begin(), metrics.end(), FLT_MAX );
+  metrics.at( 0 ) = 0;
+
+  for( uint place_value = 0; place_value < code_length; place_value++ )
+  {
+    //the cost of a bit is the reliability of the place if it
+    //disagrees with the hard decision
+    uint received_bit = ( received_word >> place_value ) & 1;
+    float zero_cost = received_bit == 1 ? reliabilities[ place_value ] : 0;
+    float one_cost = received_bit == 0 ? reliabilities[ place_value ] : 0;
+    add_compare_select( metrics.data(), new_metrics.data(),
+                        decisions.data() + place_value * decision_bytes,
+                        parity_columns.at( place_value ),
+                        zero_cost, one_cost );
+    metrics.swap( new_metrics );
+  }
+
+  //trace back from the zero syndrome
+  uint state = 0;
+  uint decoded_word = 0;
+  for( uint place_value = code_length - 1; place_value != UINT_MAX;
+       place_value-- )
+  {
+    const uint8_t *section = decisions.data() + place_value * decision_bytes;
+    uint bit = ( section[ state / 8 ] >> ( state % 8 ) ) & 1;
+    if( bit == 1 )
+    {
+      decoded_word |= 1u << place_value;
+      state ^= parity_columns.at( place_value );
+    }
+  }
+  return decoded_word;
+}
+
+void TrellisDecoder::add_compare_select( const float *metrics,
+                                         float *new_metrics,
+                                         uint8_t *decisions, uint column,
+                                         float zero_cost,
+                                         float one_cost ) const
+{
+  if( vectorized )
+  {
+    add_compare_select_avx2( metrics, new_metrics, decisions, column,
+                             zero_cost, one_cost );
+  }
+  else
+  {
+    add_compare_select_portable( metrics, new_metrics, decisions, column,
+                                 zero_cost, one_cost );
+  }
+}
+
+void TrellisDecoder::add_compare_select_portable( const float *metrics,
+                                                  float *new_metrics,
+                                                  uint8_t *decisions,
+                                                  uint column,
+                                                  float zero_cost,
+                                                  float one_cost ) const
+{
+  for( uint state = 0; state < num_states; state++ )
+  {
+    //FLT_MAX plus a cost stays FLT_MAX, so unreachable states
+    //never win a comparison against reachable ones
+    float stay = metrics[ state ] + zero_cost;
+    float cross = metrics[ state ^ column ] + one_cost;
+    bool take_cross = cross < stay;
+    new_metrics[ state ] = take_cross ? cross : stay;
+    if( take_cross )
+    {
+      decisions[ state / 8 ] |= 1u << ( state % 8 );
+    }
+    else
+    {
+      decisions[ state / 8 ] &= ~( 1u << ( state % 8 ) );
+    }
+  }
+}
+
+__attribute__(( target( "avx2" ) ))
+void TrellisDecoder::add_compare_select_avx2( const float *metrics,
+                                              float *new_metrics,
+                                              uint8_t *decisions,
+                                              uint column,
+                                              float zero_cost,
+                                              float one_cost ) const
+{
+  //eight states at a time: the predecessors s xor h of a block of
+  //eight lie in one block, permuted by the low three bits of h
+  __m256i lane_permutation = _mm256_xor_si256(
+    _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ),
+    _mm256_set1_epi32( column & 7 ) );
+  __m256 zero_costs = _mm256_set1_ps( zero_cost );
+  __m256 one_costs = _mm256_set1_ps( one_cost );
+  for( uint state = 0; state < num_states; state += 8 )
+  {
+    __m256 stay = _mm256_add_ps( _mm256_loadu_ps( metrics + state ),
+                                 zero_costs );
+    __m256 cross = _mm256_permutevar8x32_ps(
+      _mm256_loadu_ps( metrics + ( state ^ ( column & ~7u ) ) ),
+      lane_permutation );
+    cross = _mm256_add_ps( cross, one_costs );
+    __m256 take_cross = _mm256_cmp_ps( cross, stay, _CMP_LT_OQ );
+    _mm256_storeu_ps( new_metrics + state,
+                      _mm256_blendv_ps( stay, cross, take_cross ) );
+    decisions[ state / 8 ] =
+      static_cast< uint8_t >( _mm256_movemask_ps( take_cross ) );
+  }
+}
+
+#endif